@@ -31,4 +31,20 @@ ov_property_key_intel_auto_enable_startup_fallback;
  * @ingroup ov_property_c_api
  */
 OPENVINO_C_VAR(const char*)
-ov_property_key_intel_auto_enable_runtime_fallback;
\ No newline at end of file
+ov_property_key_intel_auto_enable_runtime_fallback;
+
+/**
+ * @brief Read-write property<string> to set the policy of distributing the infer requests between the devices in the
+ * cumulative throughput mode: "DEVICE_PRIORITY" or "EXPECTED_COMPLETION_TIME"
+ * @ingroup ov_property_c_api
+ */
+OPENVINO_C_VAR(const char*)
+ov_property_key_intel_auto_schedule_policy;
+
+/**
+ * @brief Read-only property<string> to get the statistics of the requests scheduling per device in the cumulative
+ * throughput mode
+ * @ingroup ov_property_c_api
+ */
+OPENVINO_C_VAR(const char*)
+ov_property_key_intel_auto_schedule_statistics;
\ No newline at end of file
@@ -226,4 +226,19 @@ ov_property_key_enable_mmap;
  * @ingroup ov_property_c_api
  */
 OPENVINO_C_VAR(const char*)
-ov_property_key_auto_batch_timeout;
\ No newline at end of file
+ov_property_key_auto_batch_timeout;
+
+/**
+ * @brief Read-write property<uint32_t string> to set the target latency (in ms) for the auto-batching, zero disables
+ * the adaptive timeout
+ * @ingroup ov_property_c_api
+ */
+OPENVINO_C_VAR(const char*)
+ov_property_key_auto_batch_latency_target;
+
+/**
+ * @brief Read-write property<bool string> to compile the models for the partial batches of the auto-batching
+ * @ingroup ov_property_c_api
+ */
+OPENVINO_C_VAR(const char*)
+ov_property_key_auto_batch_partial_batches;
\ No newline at end of file
@@ -8,3 +8,7 @@
 const char* ov_property_key_intel_auto_device_bind_buffer = "DEVICE_BIND_BUFFER";
 const char* ov_property_key_intel_auto_enable_startup_fallback = "ENABLE_STARTUP_FALLBACK";
 const char* ov_property_key_intel_auto_enable_runtime_fallback = "ENABLE_RUNTIME_FALLBACK";
+const char* ov_property_key_intel_auto_schedule_policy = "SCHEDULE_POLICY";
+
+// Read-only property key
+const char* ov_property_key_intel_auto_schedule_statistics = "SCHEDULE_STATISTICS";
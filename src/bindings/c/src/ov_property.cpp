@@ -35,4 +35,6 @@ const char* ov_property_key_device_priorities = "MULTI_DEVICE_PRIORITIES";
 const char* ov_property_key_hint_execution_mode = "EXECUTION_MODE_HINT";
 const char* ov_property_key_force_tbb_terminate = "FORCE_TBB_TERMINATE";
 const char* ov_property_key_enable_mmap = "ENABLE_MMAP";
-const char* ov_property_key_auto_batch_timeout = "AUTO_BATCH_TIMEOUT";
\ No newline at end of file
+const char* ov_property_key_auto_batch_timeout = "AUTO_BATCH_TIMEOUT";
+const char* ov_property_key_auto_batch_latency_target = "AUTO_BATCH_LATENCY_TARGET";
+const char* ov_property_key_auto_batch_partial_batches = "AUTO_BATCH_PARTIAL_BATCHES";
\ No newline at end of file
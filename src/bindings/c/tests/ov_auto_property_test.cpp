@@ -46,6 +46,8 @@ const std::vector<test_params> test_property_config = {
     test_params{"AUTO", ov_property_key_intel_auto_enable_runtime_fallback, "YES", false},
     test_params{"AUTO", ov_property_key_intel_auto_enable_runtime_fallback, "NO", false},
     test_params{"AUTO", ov_property_key_intel_auto_enable_runtime_fallback, "TEST", true},
+    test_params{"AUTO", ov_property_key_intel_auto_schedule_policy, "EXPECTED_COMPLETION_TIME", false},
+    test_params{"AUTO", ov_property_key_intel_auto_schedule_policy, "DEVICE_PRIORITY", false},
 };
 
 INSTANTIATE_TEST_SUITE_P(ov_auto_plugin_test_properties,
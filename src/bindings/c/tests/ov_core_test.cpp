@@ -440,6 +440,27 @@ TEST_P(ov_core_test, ov_core_set_and_get_property_execution_mode) {
     ov_core_free(core);
 }
 
+TEST_P(ov_core_test, ov_core_set_and_get_property_auto_batch_partial_batches) {
+    std::string device_name = "BATCH";
+    ov_core_t* core = nullptr;
+    OV_EXPECT_OK(ov_core_create(&core));
+    EXPECT_NE(nullptr, core);
+
+    const char* key = ov_property_key_auto_batch_partial_batches;
+    char* property_value = nullptr;
+    OV_EXPECT_OK(ov_core_get_property(core, device_name.c_str(), key, &property_value));
+    EXPECT_STREQ("NO", property_value);  // default value from /src/plugins/auto_batch/src/plugin.cpp
+    ov_free(property_value);
+
+    const char* enable = "YES";
+    OV_EXPECT_OK(ov_core_set_property(core, device_name.c_str(), key, enable));
+    OV_EXPECT_OK(ov_core_get_property(core, device_name.c_str(), key, &property_value));
+    EXPECT_STREQ(enable, property_value);
+    ov_free(property_value);
+
+    ov_core_free(core);
+}
+
 TEST_P(ov_core_test, ov_core_set_get_property_str) {
     auto device_name = GetParam();
     ov_core_t* core = nullptr;
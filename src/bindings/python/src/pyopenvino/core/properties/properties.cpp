@@ -25,6 +25,8 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::enable_profiling, "enable_profiling");
     wrap_property_RW(m_properties, ov::cache_dir, "cache_dir");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
+    wrap_property_RW(m_properties, ov::auto_batch_latency_target, "auto_batch_latency_target");
+    wrap_property_RW(m_properties, ov::auto_batch_partial_batches, "auto_batch_partial_batches");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
@@ -283,7 +285,17 @@ void regmodule_properties(py::module m) {
         m_properties.def_submodule("intel_auto",
                                    "openvino.runtime.properties.intel_auto submodule that simulates ov::intel_auto");
 
+    // Submodule intel_auto - enums
+    py::enum_<ov::intel_auto::SchedulePolicy>(m_intel_auto, "SchedulePolicy", py::arithmetic())
+        .value("DEVICE_PRIORITY", ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY)
+        .value("EXPECTED_COMPLETION_TIME", ov::intel_auto::SchedulePolicy::EXPECTED_COMPLETION_TIME)
+        .value("DEFAULT", ov::intel_auto::SchedulePolicy::DEFAULT);
+
+    // Submodule intel_auto - properties
     wrap_property_RW(m_intel_auto, ov::intel_auto::device_bind_buffer, "device_bind_buffer");
     wrap_property_RW(m_intel_auto, ov::intel_auto::enable_startup_fallback, "enable_startup_fallback");
     wrap_property_RW(m_intel_auto, ov::intel_auto::enable_runtime_fallback, "enable_runtime_fallback");
+    wrap_property_RW(m_intel_auto, ov::intel_auto::schedule_policy, "schedule_policy");
+
+    wrap_property_RO(m_intel_auto, ov::intel_auto::schedule_statistics, "schedule_statistics");
 }
@@ -16,6 +16,7 @@
 #include "openvino/core/meta_data.hpp"
 #include "openvino/frontend/decoder.hpp"
 #include "openvino/frontend/graph_iterator.hpp"
+#include "openvino/runtime/auto/properties.hpp"
 
 using Version = ov::pass::Serialize::Version;
 
@@ -176,6 +177,8 @@ py::object from_ov_any(const ov::Any& any) {
         return py::cast(any.as<ov::hint::SchedulingCoreType>());
     } else if (any.is<ov::hint::ExecutionMode>()) {
         return py::cast(any.as<ov::hint::ExecutionMode>());
+    } else if (any.is<ov::intel_auto::SchedulePolicy>()) {
+        return py::cast(any.as<ov::intel_auto::SchedulePolicy>());
     } else if (any.is<ov::log::Level>()) {
         return py::cast(any.as<ov::log::Level>());
     } else if (any.is<ov::device::Type>()) {
@@ -359,6 +362,8 @@ ov::Any py_object_to_any(const py::object& py_obj) {
         return py::cast<ov::hint::PerformanceMode>(py_obj);
     } else if (py::isinstance<ov::hint::SchedulingCoreType>(py_obj)) {
         return py::cast<ov::hint::SchedulingCoreType>(py_obj);
+    } else if (py::isinstance<ov::intel_auto::SchedulePolicy>(py_obj)) {
+        return py::cast<ov::intel_auto::SchedulePolicy>(py_obj);
     } else if (py::isinstance<ov::log::Level>(py_obj)) {
         return py::cast<ov::log::Level>(py_obj);
     } else if (py::isinstance<ov::device::Type>(py_obj)) {
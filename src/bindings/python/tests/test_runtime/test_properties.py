@@ -92,6 +92,14 @@ def test_deprecation():
                 (hints.ExecutionMode.ACCURACY, "ExecutionMode.ACCURACY", 2),
             ),
         ),
+        (
+            intel_auto.SchedulePolicy,
+            (
+                (intel_auto.SchedulePolicy.DEVICE_PRIORITY, "SchedulePolicy.DEVICE_PRIORITY", 0),
+                (intel_auto.SchedulePolicy.EXPECTED_COMPLETION_TIME, "SchedulePolicy.EXPECTED_COMPLETION_TIME", 1),
+                (intel_auto.SchedulePolicy.DEFAULT, "SchedulePolicy.DEVICE_PRIORITY", 0),
+            ),
+        ),
         (
             device.Type,
             (
@@ -177,6 +185,7 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (intel_gpu.uarch_version, "GPU_UARCH_VERSION"),
         (intel_gpu.execution_units_count, "GPU_EXECUTION_UNITS_COUNT"),
         (intel_gpu.memory_statistics, "GPU_MEMORY_STATISTICS"),
+        (intel_auto.schedule_statistics, "SCHEDULE_STATISTICS"),
     ],
 )
 def test_properties_ro(ov_property_ro, expected_value):
@@ -216,6 +225,15 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (
+            props.auto_batch_latency_target,
+            "AUTO_BATCH_LATENCY_TARGET",
+            (
+                (20, 20),
+                (np.uint32(5), 5),
+            ),
+        ),
+        (props.auto_batch_partial_batches, "AUTO_BATCH_PARTIAL_BATCHES", ((True, True), (False, False))),
         (
             props.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -330,6 +348,20 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (0, False),
             ),
         ),
+        (
+            intel_auto.schedule_policy,
+            "SCHEDULE_POLICY",
+            (
+                (
+                    intel_auto.SchedulePolicy.DEVICE_PRIORITY,
+                    intel_auto.SchedulePolicy.DEVICE_PRIORITY,
+                ),
+                (
+                    intel_auto.SchedulePolicy.EXPECTED_COMPLETION_TIME,
+                    intel_auto.SchedulePolicy.EXPECTED_COMPLETION_TIME,
+                ),
+            ),
+        ),
         (device.id, "DEVICE_ID", (("0", "0"),)),
         (
             log.level,
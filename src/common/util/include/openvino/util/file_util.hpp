@@ -339,6 +339,15 @@ std::vector<uint8_t> load_binary(const std::string& path);
 void save_binary(const std::string& path, std::vector<uint8_t> binary);
 void save_binary(const std::string& path, const char* binary, size_t bin_size);
 
+/**
+ * @brief Replaces the file with another one, the replacement is atomic on POSIX systems (and on NTFS on Windows), so
+ * the readers see either the old or the new content, and the memory mappings of the old file stay valid
+ * @param from - path of the new file, it is moved
+ * @param to - path of the file to replace
+ * @return true if the file is replaced
+ */
+bool replace_file(const std::string& from, const std::string& to);
+
 /**
  * @brief Trim OpenVINO project file name path if OpenVINO project directory found.
  *
@@ -7,6 +7,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
@@ -651,6 +652,20 @@ void ov::util::save_binary(const std::string& path, const char* binary, size_t b
     }
 }
 
+bool ov::util::replace_file(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+#    if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
+    return MoveFileExW(ov::util::string_to_wstring(from).c_str(),
+                       ov::util::string_to_wstring(to).c_str(),
+                       MOVEFILE_REPLACE_EXISTING) != 0;
+#    else
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#    endif
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
 const char* ov::util::trim_file_name(const char* const fname) {
     static const auto pattern_native_sep =
         std::string(OV_NATIVE_PARENT_PROJECT_ROOT_DIR) + FileTraits<char>::file_separator;
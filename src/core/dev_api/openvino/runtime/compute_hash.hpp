@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace runtime {
+
+/// \brief Computes 64-bit hash of the memory content.
+///
+/// The content is split into fixed size blocks which are hashed in parallel with XXH64 algorithm, block hashes are
+/// combined afterwards. The result doesn't depend on the number of threads, but is not compatible with the
+/// reference XXH64 digest for the buffers larger than a single block.
+/// \param src Pointer to the memory
+/// \param size Size of the memory in bytes
+/// \return 64-bit hash value
+OPENVINO_API uint64_t compute_hash(const void* src, size_t size);
+
+}  // namespace runtime
+}  // namespace ov
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <streambuf>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 
 namespace ov {
@@ -28,4 +30,23 @@ private:
     T _shared_object;
 };
 
+/// \brief SharedStreamBuffer class to read a pre-allocated buffer (e.g. a memory mapped file) as a stream
+/// without copying it. Readers aware of it may take the underlying buffer to reference its content directly.
+class OPENVINO_API SharedStreamBuffer : public std::streambuf {
+public:
+    explicit SharedStreamBuffer(std::shared_ptr<ov::AlignedBuffer> buffer);
+
+    /// \brief Returns the buffer the stream reads from
+    const std::shared_ptr<ov::AlignedBuffer>& get_buffer() const {
+        return m_buffer;
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+private:
+    std::shared_ptr<ov::AlignedBuffer> m_buffer;
+};
+
 }  // namespace ov
@@ -263,6 +263,18 @@ public:
         invalidate_values();
         validate_and_infer_types();
     }
+    /// \brief Checks if the node must be revalidated by the incremental validation (see ov::pass::Validate).
+    /// The validation is required for the new nodes, the nodes with replaced inputs and the nodes
+    /// whose input types or shapes were changed since the last validation of the model.
+    bool is_validation_required() const {
+        return m_validation_required;
+    }
+    /// \brief Marks the node to be revalidated by the incremental validation (see ov::pass::Validate).
+    /// Has to be called if the node attributes affecting the outputs were changed without
+    /// calling validate_and_infer_types().
+    void set_validation_required(bool required = true) {
+        m_validation_required = required;
+    }
     /// \brief Get the string name for the type of the node, such as `Add` or `Multiply`.
     ///        The class name, must not contain spaces as it is used for codegen.
     /// \returns A const reference to the node's type name
@@ -459,6 +471,7 @@ private:
     std::string m_friendly_name;
     mutable std::string m_unique_name;
     mutable std::atomic_bool m_name_changing{false};
+    std::atomic_bool m_validation_required{true};
     static std::atomic<size_t> m_next_instance_id;
     std::deque<descriptor::Input> m_inputs;
     std::deque<descriptor::Output> m_outputs;
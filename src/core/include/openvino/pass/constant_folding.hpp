@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -19,6 +21,12 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    /// \brief Folds the nodes by the serial traversal in the topological order.
+    ConstantFolding() = default;
+    /// \brief Enables the parallel folding of the independent nodes.
+    /// \param max_threads The maximum number of threads evaluating the independent nodes concurrently,
+    /// 0 means all the available threads and 1 keeps the serial folding of the default constructor.
+    explicit ConstantFolding(size_t max_threads) : m_max_threads(max_threads) {}
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +34,18 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the nodes with constant inputs wave by wave. The nodes of a wave don't depend on each other,
+    /// so they are evaluated concurrently, then their outputs are replaced and the consumers whose inputs
+    /// all became constants form the next wave.
+    /// \param not_folded The nodes with constant inputs which failed to fold.
+    bool parallel_folding(const std::shared_ptr<ov::Model>& model,
+                          bool revalidate,
+                          std::unordered_set<const Node*>& not_folded);
+    /// \brief Replaces the node outputs with the folded values.
+    bool replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+private:
+    size_t m_max_threads = 1;
 };
 
 /**
@@ -160,9 +160,9 @@ private:
 /// class.
 /// As a default algorithm graph rewrite pass traverse Function in topological order and
 /// applies
-/// registered matcher passes for each node. But if all registered matcher passes have type
-/// based
-/// root node in Matcher pattern then efficient mechanism is used to execute them.
+/// registered matcher passes for each node. Matcher passes which have type based root node
+/// in Matcher pattern are tried only for the nodes of this type (or derived types), while
+/// the others are tried for each node.
 /// Matcher pattern root is type based if it's operation from opset or
 /// pattern::op::WrapType.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation
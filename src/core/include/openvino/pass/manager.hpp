@@ -43,7 +43,7 @@ public:
         auto rc = push_pass<T>(std::forward<Args>(args)...);
         rc->set_pass_config(m_pass_config);
         if (m_per_pass_validation) {
-            push_pass<Validate>();
+            push_pass<Validate>(m_incremental_validation);
         }
         if (!Enable && !m_pass_config->is_enabled<T>()) {
             m_pass_config->disable<T>();
@@ -55,7 +55,7 @@ public:
         pass->set_pass_config(m_pass_config);
         m_pass_list.push_back(pass);
         if (m_per_pass_validation) {
-            push_pass<Validate>();
+            push_pass<Validate>(m_incremental_validation);
         }
         return pass;
     }
@@ -76,6 +76,11 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable the incremental validation by the Validate passes added
+    /// after each registered pass (see \link ov::pass::Validate \endlink)
+    /// \param new_state Value "true" enables the incremental validation; "false", otherwise
+    void set_incremental_validation(bool new_state);
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -99,6 +104,7 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_incremental_validation = false;
 };
 }  // namespace pass
 }  // namespace ov
@@ -21,13 +21,30 @@ namespace pass {
 /// pass does not break the shape and data type requirement on a computation node.
 /// This default validation run can be changed via calling the
 /// \link ov::pass::Manager::set_per_pass_validation(bool) \endlink function.
+///
+/// The incremental validation revalidates only the nodes modified since the previous validation
+/// and the nodes downstream of them (see \link ov::Node::is_validation_required() \endlink).
+/// It is enabled by the constructor argument or by
+/// \link ov::pass::Manager::set_incremental_validation(bool) \endlink function.
 /// \ingroup ov_pass_cpp_api
 class OPENVINO_API Validate : public ModelPass {
 public:
     OPENVINO_RTTI("ov::pass::Validate");
 
-    Validate() : ModelPass() {}
+    /// \param incremental  Revalidate only the modified nodes and the nodes downstream of them. The passes run
+    ///                     before have to mark the nodes whose attributes they change without calling
+    ///                     validate_and_infer_types() by \link ov::Node::set_validation_required() \endlink.
+    explicit Validate(bool incremental = false) : ModelPass(), m_incremental(incremental) {}
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+
+    /// \brief Returns the number of the nodes revalidated by the last run of the pass.
+    size_t get_validated_nodes() const {
+        return m_validated_nodes;
+    }
+
+private:
+    bool m_incremental = false;
+    size_t m_validated_nodes = 0;
 };
 }  // namespace pass
 }  // namespace ov
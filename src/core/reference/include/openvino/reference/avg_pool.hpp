@@ -11,6 +11,7 @@
 
 #include "openvino/core/axis_vector.hpp"
 #include "openvino/core/coordinate.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/reference/rounding_guard.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
@@ -122,7 +123,6 @@ void avg_pool(const T* const arg,
               const bool include_padding_in_avg_computation) {
     if (window_shape.size() > 3)
         return;
-    const RoundingGuard rounding_g{FE_TONEAREST};
 
     const auto not_zero = [](size_t p) {
         return p != 0;
@@ -154,21 +154,21 @@ void avg_pool(const T* const arg,
     const auto out_batch_elems = shape_size(std::begin(out_shape) + 1, std::end(out_shape));
     const auto out_channel_elems = shape_size(std::begin(out_shape) + 2, std::end(out_shape));
 
-    for (size_t b = 0; b < arg_shape[0]; ++b) {
-        for (size_t c = 0; c < arg_shape[1]; ++c) {
-            const T* data_channel_first_elem = arg + b * data_batch_elems + c * data_channel_elems;
-            T* out_channel_first_elem = out + b * out_batch_elems + c * out_channel_elems;
-            kernel::avg_pool_3d(data_channel_first_elem,
-                                out_channel_first_elem,
-                                arg_shape_3D,
-                                out_shape_3D,
-                                window_shape_3D,
-                                window_movement_strides_3D,
-                                padding_below_3D,
-                                padding_above_3D,
-                                pads_in_avg);
-        }
-    }
+    ov::parallel_for2d(arg_shape[0], arg_shape[1], [&](size_t b, size_t c) {
+        // the rounding mode is set per thread
+        const RoundingGuard rounding_g{FE_TONEAREST};
+        const T* data_channel_first_elem = arg + b * data_batch_elems + c * data_channel_elems;
+        T* out_channel_first_elem = out + b * out_batch_elems + c * out_channel_elems;
+        kernel::avg_pool_3d(data_channel_first_elem,
+                            out_channel_first_elem,
+                            arg_shape_3D,
+                            out_shape_3D,
+                            window_shape_3D,
+                            window_movement_strides_3D,
+                            padding_below_3D,
+                            padding_above_3D,
+                            pads_in_avg);
+    });
 }
 }  // namespace reference
 }  // namespace ov
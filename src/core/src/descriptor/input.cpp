@@ -31,12 +31,18 @@ ov::descriptor::Input::~Input() {
 }
 
 void ov::descriptor::Input::replace_output(Output& new_output) {
+    // Reconnection to the same output is not a graph mutation, so neither the topological cache
+    // nor the validation state must be reset
+    if (m_output == &new_output) {
+        return;
+    }
     if (m_output != nullptr) {
         m_output->remove_input(this);
     }
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<ov::Node>(new_output.get_node());
+    m_node->set_validation_required();
 
     // Output replacement may change the topological order of nodes,
     // so we have to reset cache by setting a flag into shared node info.
@@ -10,12 +10,14 @@
 
 #include "itt.hpp"
 #include "layout_utils.hpp"
+#include "model_validation.hpp"
 #include "ngraph/evaluator.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/variable_context.hpp"
 #include "openvino/op/util/variable_extension.hpp"
@@ -218,8 +220,16 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
 }
 
 void ov::Model::validate_nodes_and_infer_types() const {
+    ov::util::validate_nodes_and_infer_types(*this, false);
+}
+
+size_t ov::util::validate_nodes_and_infer_types(const ov::Model& model, bool incremental) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_nodes_and_infer_types");
 
+    const auto& parameters = model.get_parameters();
+    const auto& variables = model.get_variables();
+    size_t validated_nodes = 0;
+
     struct Counter {
         int cnt_assign = 0;
         int cnt_read_val = 0;
@@ -229,8 +239,25 @@ void ov::Model::validate_nodes_and_infer_types() const {
     std::stringstream unregistered_variables;
     std::unordered_set<const ov::descriptor::Tensor*> tensors;
 
-    for (auto& node : get_ordered_ops()) {
-        node->revalidate_and_infer_types();
+    for (auto& node : model.get_ordered_ops()) {
+        const auto& variable_op = dynamic_pointer_cast<op::util::VariableExtension>(node);
+        const auto modified = node->is_validation_required();
+        // the parameters, the variables and the bodies of the operations with subgraphs may be changed
+        // without marking the nodes, so these nodes are always revalidated, which is cheap for them
+        if (!incremental || modified || op::util::is_parameter(node) || variable_op ||
+            ov::is_type<op::util::MultiSubGraphOp>(node)) {
+            node->revalidate_and_infer_types();
+            node->set_validation_required(false);
+            ++validated_nodes;
+            // the output values may change even if the output types remain the same,
+            // so the whole subgraph downstream of the modified node is revalidated
+            if (incremental && modified) {
+                for (const auto& output : node->outputs()) {
+                    for (const auto& input : output.get_target_inputs())
+                        input.get_node()->set_validation_required();
+                }
+            }
+        }
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -239,12 +266,11 @@ void ov::Model::validate_nodes_and_infer_types() const {
             tensors.insert(&tensor);
         }
         if (op::util::is_parameter(node) &&
-            std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
+            std::find(parameters.begin(), parameters.end(), node) == parameters.end())
             unregistered_parameters << node << std::endl;
 
-        const auto& variable_op = dynamic_pointer_cast<op::util::VariableExtension>(node);
         if (variable_op &&
-            std::find(m_variables.begin(), m_variables.end(), variable_op->get_variable()) == m_variables.end())
+            std::find(variables.begin(), variables.end(), variable_op->get_variable()) == variables.end())
             unregistered_variables << variable_op->get_variable_id() << std::endl;
 
         if (const auto& assign = std::dynamic_pointer_cast<ov::op::util::AssignBase>(node)) {
@@ -268,7 +294,7 @@ void ov::Model::validate_nodes_and_infer_types() const {
     OPENVINO_ASSERT(only_pairs,
                     "Model is incorrect. Assign and ReadValue operations must be in pairs on the "
                     "network.");
-    for (const auto& output : outputs()) {
+    for (const auto& output : model.outputs()) {
         OPENVINO_ASSERT(ov::layout::utils::is_compatible(ov::layout::get_layout(output), output.get_partial_shape()),
                         "Result '",
                         output,
@@ -277,6 +303,7 @@ void ov::Model::validate_nodes_and_infer_types() const {
                         " is incompatible with layout ",
                         ov::layout::get_layout(output).to_string());
     }
+    return validated_nodes;
 }
 
 std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
@@ -285,6 +312,7 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
 
     NodeVector nodes;
     if (m_shared_rt_info->get_use_topological_cache()) {
+        nodes.reserve(m_cached_ordered_ops.size());
         for (const auto& node : m_cached_ordered_ops) {
             if (auto locked_node = node.lock()) {
                 nodes.emplace_back(locked_node);
@@ -308,6 +336,8 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
     m_cached_ordered_ops.clear();
+    m_cached_ordered_ops.reserve(order.size());
+    m_cached_ops.clear();
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
         m_cached_ops.insert(node.get());
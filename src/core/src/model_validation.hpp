@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace util {
+
+/// \brief Revalidates the nodes of the model and checks the consistency of the model.
+///
+/// \param model        Model to validate.
+/// \param incremental  Revalidate only the nodes which require it (see ov::Node::is_validation_required())
+///                     together with the nodes downstream of them, otherwise all the nodes are revalidated.
+///
+/// \return The number of the revalidated nodes.
+size_t validate_nodes_and_infer_types(const ov::Model& model, bool incremental);
+
+}  // namespace util
+}  // namespace ov
@@ -13,6 +13,7 @@
 #include "bound_evaluate.hpp"
 #include "itt.hpp"
 #include "openvino/core/descriptor/input.hpp"
+#include "openvino/core/dimension_tracker.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/shape_util.hpp"
 #include "openvino/pass/constant_folding.hpp"
@@ -27,6 +28,18 @@ namespace {
 static const char node_idx_out_of_range_txt[] = "node index is out of range";
 static const char idx_txt[] = "index '";
 static const char out_of_range_txt[] = "' out of range";
+
+bool same_shapes_and_labels(const ov::PartialShape& lhs, const ov::PartialShape& rhs) {
+    if (lhs.rank().is_dynamic() || rhs.rank().is_dynamic())
+        return lhs.rank().is_dynamic() && rhs.rank().is_dynamic();
+    if (lhs.size() != rhs.size())
+        return false;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i] != rhs[i] || ov::DimensionTracker::get_label(lhs[i]) != ov::DimensionTracker::get_label(rhs[i]))
+            return false;
+    }
+    return true;
+}
 }  // namespace
 
 void ov::NodeValidationFailure::create(const CheckLocInfo& check_loc_info,
@@ -96,12 +109,10 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 }
 
 ov::Node::~Node() {
+    // The topological cache is not reset here: a node of the cached order is referenced by its consumers,
+    // so it may be destroyed only after the mutation which has already reset the cache, while the expired
+    // nodes are skipped by Model::get_ordered_ops()
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
-        });
-
         for (descriptor::Input& input : m_inputs) {
             if (input.has_output()) {
                 // This test adds 1 to the actual count, so a count of 2 means this input is the only
@@ -222,6 +233,7 @@ ov::descriptor::Output& ov::Node::get_output_descriptor(size_t position) {
 }
 
 void ov::Node::set_argument(size_t position, const Output<Node>& argument) {
+    set_validation_required();
     auto output_node = argument.get_node();
     auto& output_descriptor = output_node->m_outputs.size() > argument.get_index()
                                   ? output_node->m_outputs.at(argument.get_index())
@@ -266,8 +278,16 @@ void ov::Node::set_input_is_relevant_to_value(size_t i, bool relevant) {
 }
 
 void ov::Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape) {
+    auto& output = get_output_descriptor(i);
+    const auto& tensor = output.get_tensor();
+    // the consumers have to be revalidated if the output was changed by the validation of the node
+    // which is not tracked, e.g. after changing the node attributes
+    if (tensor.get_element_type() != element_type || !same_shapes_and_labels(tensor.get_partial_shape(), pshape)) {
+        for (const auto& input : output.get_inputs())
+            input->get_raw_pointer_node()->set_validation_required();
+    }
     OPENVINO_SUPPRESS_DEPRECATED_START
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    output.get_tensor_ptr()->set_tensor_type(element_type, pshape);
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 
@@ -316,16 +336,20 @@ const std::vector<ov::Node*>& ov::Node::get_control_dependents() const {
 }
 
 void ov::Node::add_control_dependency(std::shared_ptr<Node> node) {
-    if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) == m_control_dependencies.end()) {
-        m_control_dependencies.push_back(node);
-        if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
-            node->m_control_dependents.end()) {
-            node->m_control_dependents.push_back(this);
-        }
+    if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) != m_control_dependencies.end()) {
+        return;
+    }
+    m_control_dependencies.push_back(node);
+    if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
+        node->m_control_dependents.end()) {
+        node->m_control_dependents.push_back(this);
     }
 
     // control dependency may change the topological order so we have to reset cache
     // by setting a flag into shared node info.
+    for_each(this->m_shared_rt_info.cbegin(), this->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
+        info->set_use_topological_cache(false);
+    });
     for_each(node->m_shared_rt_info.cbegin(), node->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
         info->set_use_topological_cache(false);
     });
@@ -353,6 +377,10 @@ void ov::Node::remove_control_dependency(std::shared_ptr<Node> node) {
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end()) {
             m_control_dependencies.erase(it);
+            // the dependency may become unreachable
+            for (const auto& info : m_shared_rt_info) {
+                info->set_use_topological_cache(false);
+            }
         }
     }
     {
@@ -370,6 +398,11 @@ void ov::Node::clear_control_dependencies() {
             node->m_control_dependents.erase(it);
         }
     }
+    if (!m_control_dependencies.empty()) {
+        for (const auto& info : m_shared_rt_info) {
+            info->set_use_topological_cache(false);
+        }
+    }
     m_control_dependencies.clear();
 }
 
@@ -4,7 +4,10 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <atomic>
+
 #include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
@@ -48,42 +51,50 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Check if the node may be folded concurrently with other nodes.
+ *
+ * The node must have only constant inputs, so it doesn't depend on other nodes being folded.
+ * The operations with subgraphs are folded by the serial traversal, which also folds their bodies.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if the node may be folded in parallel otherwise false.
+ */
+const auto is_parallel_foldable = [](const ov::Node* node) {
+    const auto inputs_num = node->get_input_size();
+    if (inputs_num == 0 || ov::is_type<ov::op::util::MultiSubGraphOp>(node))
+        return false;
+    for (size_t i = 0; i < inputs_num; ++i) {
+        if (!ov::is_type<ov::op::v0::Constant>(node->get_input_node_ptr(i)))
+            return false;
+    }
+    return true;
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
+    std::unordered_set<const Node*> not_folded;
+    // a single thread keeps the original serial traversal and its folding order
+    if (m_max_threads != 1)
+        rewritten = parallel_folding(model, rewritten, not_folded) || rewritten;
+
     for (const auto& node : model->get_ordered_ops()) {
         if (rewritten) {
             node->validate_and_infer_types();
         }
 
+        // the nodes with constant inputs have already been tried by the parallel folding
+        if (not_folded.count(node.get()))
+            continue;
+
         OutputVector replacements(node->get_output_size());
 
         if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
-
-                    rewritten = true;
-                }
-            }
+            rewritten = replace_outputs(node, replacements) || rewritten;
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -98,6 +109,101 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ov::Model>& model,
+                                                 bool revalidate,
+                                                 std::unordered_set<const Node*>& not_folded) {
+    std::vector<std::shared_ptr<Node>> wave;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (is_parallel_foldable(node.get()))
+            wave.push_back(node);
+    }
+
+    const auto max_threads = parallel_get_max_threads();
+    const auto threads_num =
+        m_max_threads == 0 ? max_threads : std::min(static_cast<int>(m_max_threads), max_threads);
+    bool rewritten = false;
+    while (!wave.empty()) {
+        // shapes and types of the nodes may depend on the values of the inputs which have just been folded
+        if (revalidate) {
+            for (const auto& node : wave)
+                node->validate_and_infer_types();
+        }
+
+        std::vector<OutputVector> replacements(wave.size());
+        std::vector<char> folded(wave.size(), false);
+        std::vector<std::exception_ptr> errors(wave.size());
+        std::atomic<size_t> next_node{0};
+        // the cost of folding differs a lot between the nodes, so the nodes are distributed dynamically
+        ov::parallel_nt(std::min(threads_num, static_cast<int>(wave.size())), [&](const int, const int) {
+            for (size_t i = next_node++; i < wave.size(); i = next_node++) {
+                try {
+                    replacements[i].resize(wave[i]->get_output_size());
+                    folded[i] = wave[i]->constant_fold(replacements[i], wave[i]->input_values());
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        });
+
+        // the graph is modified serially, in the topological order of the folded nodes
+        std::vector<std::shared_ptr<Node>> consumers;
+        std::unordered_set<const Node*> visited;
+        for (size_t i = 0; i < wave.size(); ++i) {
+            if (errors[i])
+                std::rethrow_exception(errors[i]);
+            const auto& node = wave[i];
+            if (!folded[i]) {
+                not_folded.insert(node.get());
+                continue;
+            }
+            for (const auto& output : node->outputs()) {
+                for (const auto& target : output.get_target_inputs()) {
+                    const auto consumer = target.get_node();
+                    if (visited.insert(consumer).second)
+                        consumers.push_back(consumer->shared_from_this());
+                }
+            }
+            rewritten = replace_outputs(node, replacements[i]) || rewritten;
+        }
+
+        wave.clear();
+        for (const auto& consumer : consumers) {
+            if (is_parallel_foldable(consumer.get()))
+                wave.push_back(consumer);
+        }
+        revalidate = true;
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
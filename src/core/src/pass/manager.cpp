@@ -18,6 +18,7 @@
 #include "openvino/pass/visualize_tree.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
+#include "pass_profiler.hpp"
 #include "perf_counters.hpp"
 
 using namespace std;
@@ -56,6 +57,10 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::set_incremental_validation(bool new_state) {
+    m_incremental_validation = new_state;
+}
+
 bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     OPENVINO_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::Manager::run_passes");
@@ -70,6 +75,14 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     bool pass_applied = false;
     bool function_changed = false;
     bool needs_validate = false;
+    // the statistics of the incremental validation
+    ngraph::stopwatch validation_timer;
+    size_t validation_runs = 0;
+    size_t validated_nodes = 0;
+    size_t total_nodes = 0;
+    // the report of the nested managers goes to the pass which runs them
+    const bool profile_report = PassProfiler::is_enabled();
+    PassProfiler::Scope manager_scope(profile_report, "pass::Manager", "manager", *func);
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             OPENVINO_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -77,6 +90,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
+        PassProfiler::Scope pass_scope(profile_report, pass->get_name(), "pass", *func);
 
         pass_timer.start();
 
@@ -100,10 +114,17 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 continue;
             }
 
-            if (dynamic_pointer_cast<Validate>(pass)) {
+            if (auto validate = dynamic_pointer_cast<Validate>(pass)) {
                 if (needs_validate) {
+                    validation_timer.start();
                     function_pass->run_on_model(func);
+                    validation_timer.stop();
                     needs_validate = false;
+                    if (profile_enabled) {
+                        ++validation_runs;
+                        validated_nodes += validate->get_validated_nodes();
+                        total_nodes += func->get_ordered_ops().size();
+                    }
                 }
             } else {
                 pass_applied = function_pass->run_on_model(func);
@@ -134,6 +155,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
         index++;
         pass_timer.stop();
+        pass_scope.stop(pass_applied);
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms" << (pass_applied ? " + " : "   ")
                  << pass->get_name() << "\n";
@@ -141,8 +163,26 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         function_changed = function_changed || pass_applied;
         needs_validate = pass_applied;
     }
+    manager_scope.stop(function_changed);
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        if (validation_runs != 0) {
+            // the time of the skipped nodes validation is estimated by the average time per validated node
+            const double validation_time = validation_timer.get_total_microseconds() / 1000.0;
+            const double saved_time =
+                validated_nodes != 0 ? validation_time * (total_nodes - validated_nodes) / validated_nodes : 0.0;
+            cout << "validation done " << validation_runs << " times in " << validation_time << "ms, "
+                 << validated_nodes << " of " << total_nodes << " nodes revalidated, ~" << saved_time
+                 << "ms saved\n";
+        }
+        const auto matcher_stats = matcher_pass_counters().flush();
+        if (!matcher_stats.empty()) {
+            cout << "matcher passes (time, hits, misses):\n";
+            for (const auto& stat : matcher_stats) {
+                cout << setw(10) << stat.time.count() / 1000000.0 << "ms" << setw(8) << stat.hits << setw(10)
+                     << stat.misses << "   " << stat.name << "\n";
+            }
+        }
     }
     OPENVINO_SUPPRESS_DEPRECATED_END
 
@@ -0,0 +1,214 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "pass_profiler.hpp"
+
+#include <fstream>
+#include <mutex>
+
+#include "openvino/util/env_util.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/log.hpp"
+#include "perf_counters.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+// clang-format off
+#    include <psapi.h>
+// clang-format on
+#elif defined(__linux__)
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace pass {
+namespace {
+int64_t get_resident_memory_kb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    pmc.cb = sizeof(PROCESS_MEMORY_COUNTERS);
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, pmc.cb))
+        return static_cast<int64_t>(pmc.WorkingSetSize / 1024);
+#elif defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    int64_t size = 0, resident = 0;
+    if (statm >> size >> resident)
+        return resident * static_cast<int64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#endif
+    return 0;
+}
+
+int64_t count_nodes(const Model& model) {
+    return static_cast<int64_t>(model.get_ordered_ops().size());
+}
+
+std::string escape_json(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+std::string escape_csv(const std::string& str) {
+    if (str.find_first_of(",\"") == std::string::npos)
+        return str;
+    std::string escaped = "\"";
+    for (const char c : str) {
+        if (c == '"')
+            escaped += '"';
+        escaped += c;
+    }
+    return escaped + '"';
+}
+
+void write_json(std::ostream& out, const PassRecord& record) {
+    out << "{\"name\":\"" << escape_json(record.name) << "\",\"kind\":\"" << record.kind
+        << "\",\"time_ms\":" << record.time_ms;
+    if (record.kind == "matcher") {
+        out << ",\"hits\":" << record.hits << ",\"misses\":" << record.misses;
+    } else {
+        out << ",\"applied\":" << (record.applied ? "true" : "false") << ",\"nodes_before\":" << record.nodes_before
+            << ",\"nodes_after\":" << record.nodes_after << ",\"memory_delta_kb\":" << record.memory_delta_kb;
+    }
+    if (!record.children.empty()) {
+        out << ",\"children\":[";
+        for (size_t i = 0; i < record.children.size(); ++i) {
+            if (i != 0)
+                out << ',';
+            write_json(out, record.children[i]);
+        }
+        out << ']';
+    }
+    out << '}';
+}
+
+void write_csv(std::ostream& out, const PassRecord& record, const std::string& parent_path) {
+    const auto path = parent_path.empty() ? record.name : parent_path + '/' + record.name;
+    out << escape_csv(path) << ',' << record.kind << ',' << record.time_ms << ',' << record.applied << ','
+        << record.nodes_before << ',' << record.nodes_after << ',' << record.memory_delta_kb << ',' << record.hits
+        << ',' << record.misses << '\n';
+    for (const auto& child : record.children) {
+        write_csv(out, child, path);
+    }
+}
+
+void add_matchers(PassRecord& record, std::vector<MatcherPassCounters::Stat> stats) {
+    for (auto& stat : stats) {
+        PassRecord matcher;
+        matcher.name = std::move(stat.name);
+        matcher.kind = "matcher";
+        matcher.time_ms = std::chrono::duration<double, std::milli>(stat.time).count();
+        matcher.hits = stat.hits;
+        matcher.misses = stat.misses;
+        record.children.push_back(std::move(matcher));
+    }
+}
+
+void write_report(const PassRecord& record, const std::string& path) {
+    static std::mutex report_mutex;
+    std::lock_guard<std::mutex> lock(report_mutex);
+
+    const bool csv = ov::util::get_file_ext(path) == ".csv";
+    const bool new_file = !ov::util::file_exists(path);
+    std::ofstream out(path, std::ios::app);
+    if (!out.is_open()) {
+        OPENVINO_WARN << "Cannot open the passes profiling report " << path;
+        return;
+    }
+    if (csv) {
+        if (new_file)
+            out << "path,kind,time_ms,applied,nodes_before,nodes_after,memory_delta_kb,hits,misses\n";
+        write_csv(out, record, {});
+    } else {
+        write_json(out, record);
+        out << '\n';
+    }
+}
+}  // namespace
+
+bool PassProfiler::is_enabled() {
+    return is_active() || !ov::util::getenv_string("OV_PROFILE_PASS_REPORT").empty();
+}
+
+bool PassProfiler::is_active() {
+    return !get().m_stack.empty();
+}
+
+PassProfiler& PassProfiler::get() {
+    static thread_local PassProfiler profiler;
+    return profiler;
+}
+
+void PassProfiler::begin(const std::string& name, const char* kind, const Model& model) {
+    Frame frame;
+    frame.record.name = name;
+    frame.record.kind = kind;
+    if (m_stack.empty()) {
+        m_report_path = ov::util::getenv_string("OV_PROFILE_PASS_REPORT");
+    }
+    // nothing changes the model between the passes of a manager
+    const bool in_manager = !m_stack.empty() && m_stack.back().record.kind == "manager";
+    frame.record.nodes_before = in_manager ? m_stack.back().nodes : count_nodes(model);
+    frame.nodes = frame.record.nodes_before;
+    frame.memory_kb = get_resident_memory_kb();
+    // the matchers applied so far belong to the enclosing pass
+    auto stats = matcher_pass_counters().flush();
+    if (!m_stack.empty())
+        add_matchers(m_stack.back().record, std::move(stats));
+    frame.start = std::chrono::steady_clock::now();
+    m_stack.push_back(std::move(frame));
+}
+
+void PassProfiler::end(const Model& model, bool applied) {
+    auto frame = std::move(m_stack.back());
+    m_stack.pop_back();
+
+    auto& record = frame.record;
+    record.time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame.start).count();
+    record.memory_delta_kb = get_resident_memory_kb() - frame.memory_kb;
+    if (record.kind == "manager") {
+        record.nodes_after = frame.nodes;
+    } else {
+        record.nodes_after = applied ? count_nodes(model) : record.nodes_before;
+    }
+    record.applied = applied;
+    // the nested passes have already taken their matchers, so the rest are applied by this pass directly
+    add_matchers(record, matcher_pass_counters().flush());
+
+    if (m_stack.empty()) {
+        write_report(record, m_report_path);
+    } else {
+        m_stack.back().nodes = record.nodes_after;
+        m_stack.back().record.children.push_back(std::move(record));
+    }
+}
+
+PassProfiler::Scope::Scope(bool enabled, const std::string& name, const char* kind, const Model& model) {
+    if (enabled) {
+        get().begin(name, kind, model);
+        m_model = &model;
+    }
+}
+
+PassProfiler::Scope::~Scope() {
+    try {
+        stop(false);
+    } catch (...) {
+    }
+}
+
+void PassProfiler::Scope::stop(bool applied) {
+    if (m_model) {
+        get().end(*m_model, applied);
+        m_model = nullptr;
+    }
+}
+}  // namespace pass
+}  // namespace ov
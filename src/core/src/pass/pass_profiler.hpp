@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace pass {
+/// \brief Profiling record of a pass::Manager run, a pass or a MatcherPass applied by GraphRewrite.
+struct PassRecord {
+    std::string name;
+    // "manager", "pass" or "matcher"
+    std::string kind;
+    double time_ms = 0;
+    int64_t nodes_before = 0;
+    int64_t nodes_after = 0;
+    // the change of the process resident memory during the run
+    int64_t memory_delta_kb = 0;
+    bool applied = false;
+    // the number of the successful and failed applications, collected for the matchers only
+    size_t hits = 0;
+    size_t misses = 0;
+    std::vector<PassRecord> children;
+};
+
+/// \brief Collects the per-pass profiling report when OV_PROFILE_PASS_REPORT environment variable is set to
+/// the report file path. The variable is read at the start of each outermost pass::Manager run. The passes
+/// executed within a pass (nested pass::Manager runs and the matchers of GraphRewrite) are reported as its
+/// children. The report of each outermost pass::Manager run is appended to the file as a JSON line, or as
+/// CSV rows if the file has ".csv" extension. The nodes are counted after the applied passes only, a pass
+/// which is not applied is expected to leave the model intact.
+class PassProfiler {
+public:
+    static bool is_enabled();
+    /// \brief Returns true while a pass is profiled on the calling thread
+    static bool is_active();
+
+    /// \brief Profiles a pass from the construction until stop() is called or the scope is left
+    class Scope {
+    public:
+        Scope(bool enabled, const std::string& name, const char* kind, const Model& model);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        void stop(bool applied);
+
+    private:
+        const Model* m_model = nullptr;
+    };
+
+private:
+    struct Frame {
+        PassRecord record;
+        std::chrono::steady_clock::time_point start;
+        int64_t memory_kb;
+        // the node count after the last pass run by the manager, the passes of a manager run one after another
+        // so the next one starts with it
+        int64_t nodes = 0;
+    };
+
+    // the profiler of the calling thread
+    static PassProfiler& get();
+
+    void begin(const std::string& name, const char* kind, const Model& model);
+    void end(const Model& model, bool applied);
+
+    std::vector<Frame> m_stack;
+    std::string m_report_path;
+};
+}  // namespace pass
+}  // namespace ov
@@ -3,6 +3,11 @@
 //
 #include "perf_counters.hpp"
 
+#include <algorithm>
+
+#include "openvino/util/env_util.hpp"
+#include "pass_profiler.hpp"
+
 namespace ov {
 namespace pass {
 openvino::itt::handle_t PerfCounters::operator[](ov::Node::type_info_t const& type_inf) {
@@ -12,5 +17,39 @@ openvino::itt::handle_t PerfCounters::operator[](ov::Node::type_info_t const& ty
         return it->second;
     return m_counters[&type_inf] = openvino::itt::handle(type_inf.name);
 }
+
+bool MatcherPassCounters::is_enabled() {
+    static const bool enabled =
+        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    return enabled || PassProfiler::is_active();
+}
+
+void MatcherPassCounters::update(const std::string& name, bool hit, std::chrono::nanoseconds time) {
+    auto& stat = m_stats[name];
+    if (hit)
+        ++stat.hits;
+    else
+        ++stat.misses;
+    stat.time += time;
+}
+
+std::vector<MatcherPassCounters::Stat> MatcherPassCounters::flush() {
+    std::vector<Stat> stats;
+    stats.reserve(m_stats.size());
+    for (auto& stat : m_stats) {
+        stats.push_back(std::move(stat.second));
+        stats.back().name = stat.first;
+    }
+    m_stats.clear();
+    std::sort(stats.begin(), stats.end(), [](const Stat& lhs, const Stat& rhs) {
+        return lhs.time > rhs.time;
+    });
+    return stats;
+}
+
+MatcherPassCounters& matcher_pass_counters() {
+    static thread_local MatcherPassCounters counters;
+    return counters;
+}
 }  // namespace pass
 }  // namespace ov
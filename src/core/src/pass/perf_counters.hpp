@@ -3,9 +3,12 @@
 //
 #pragma once
 
+#include <chrono>
 #include <itt.hpp>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "openvino/core/node.hpp"
 
@@ -28,5 +31,39 @@ private:
     std::mutex m_mutex;
     counters_map m_counters;
 };
+
+/// \brief Statistics of the MatcherPass applications collected by GraphRewrite when the passes profiling is
+/// enabled by OV_PROFILE_PASS_ENABLE or OV_PROFILE_PASS_REPORT environment variable. The pass::Manager prints
+/// and resets them after the passes are done, so the slow matchers of a pipeline can be found. The statistics
+/// are collected per thread, as GraphRewrite applies the matchers in the thread which runs the passes.
+class MatcherPassCounters {
+    MatcherPassCounters(MatcherPassCounters const&) = delete;
+    MatcherPassCounters& operator=(MatcherPassCounters const&) = delete;
+
+public:
+    struct Stat {
+        std::string name;
+        // the number of the applications which have changed the graph
+        size_t hits = 0;
+        // the number of the applications which have left the graph intact
+        size_t misses = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    MatcherPassCounters() = default;
+
+    static bool is_enabled();
+
+    void update(const std::string& name, bool hit, std::chrono::nanoseconds time);
+
+    /// \brief Returns the collected statistics sorted by the time in the descending order and resets them
+    std::vector<Stat> flush();
+
+private:
+    std::unordered_map<std::string, Stat> m_stats;
+};
+
+/// \brief Returns the matcher statistics of the calling thread
+MatcherPassCounters& matcher_pass_counters();
 }  // namespace pass
 }  // namespace ov
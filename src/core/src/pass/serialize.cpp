@@ -22,6 +22,7 @@
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/file_util.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
@@ -91,9 +92,10 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool hash_only = false)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_hash_only(hash_only),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr,
@@ -105,6 +107,18 @@ public:
         const auto offset = write_pos - m_blob_offset;
         *new_size = size;
 
+        if (m_hash_only) {
+            // Content is hashed in place: neither the data is copied to the output stream
+            // nor fp16 compression is done, only the resulting size is reported
+            if (compress_to_fp16) {
+                OPENVINO_ASSERT(size % src_type.size() == 0);
+                *new_size = size / src_type.size() * ov::element::f16.size();
+            }
+            const uint64_t hash = ov::runtime::compute_hash(ptr, size);
+            m_hash ^= hash + 0x9e3779b9 + (m_hash << 6) + (m_hash >> 2);
+            return offset;
+        }
+
         if (!m_enable_compression || compress_to_fp16) {
             write_with_optional_fp16_compression(ptr, size, new_size, compress_to_fp16, src_type);
             return offset;
@@ -135,6 +149,10 @@ public:
         return offset;
     }
 
+    uint64_t get_hash() const {
+        return m_hash;
+    }
+
 private:
     void write_with_optional_fp16_compression(const char* ptr,
                                               size_t size,
@@ -190,6 +208,8 @@ private:
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_hash_only;
+    uint64_t m_hash = 0;  // combined hash of the constants content in hash_only mode
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
@@ -1169,7 +1189,7 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
 }
 
 void serializeFunc(std::ostream& xml_file,
-                   std::ostream& bin_file,
+                   ConstantWriter& constant_write_handler,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
@@ -1194,12 +1214,21 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
     xml_doc.save(xml_file);
     xml_file.flush();
+}
+
+void serializeFunc(std::ostream& xml_file,
+                   std::ostream& bin_file,
+                   std::shared_ptr<ov::Model> model,
+                   ov::pass::Serialize::Version ver,
+                   const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                   bool deterministic = false) {
+    ConstantWriter constant_write_handler(bin_file);
+    serializeFunc(xml_file, constant_write_handler, model, ver, custom_opsets, deterministic);
     bin_file.flush();
 };
 
@@ -1408,12 +1437,14 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
 
+    // Constants are not written to the stream, their content is hashed in place in parallel
+    ConstantWriter constant_hash_handler(bin, false, true);
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, constant_hash_handler, model, Serialize::Version::UNSPECIFIED, {}, true);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    seed = hash_combine(seed, constant_hash_handler.get_hash());
 
     m_hash = seed;
     // Return false because we didn't change OpenVINO Model
@@ -4,10 +4,11 @@
 
 #include "openvino/pass/validate.hpp"
 
+#include "model_validation.hpp"
 #include "openvino/cc/pass/itt.hpp"
 
 bool ov::pass::Validate::run_on_model(const std::shared_ptr<ov::Model>& m) {
     RUN_ON_MODEL_SCOPE(Validate);
-    m->validate_nodes_and_infer_types();
+    m_validated_nodes = ov::util::validate_nodes_and_infer_types(*m, m_incremental);
     return false;
 }
@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/compute_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace runtime {
+namespace {
+
+// XXH64 primes
+constexpr uint64_t prime64_1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t prime64_2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t prime64_3 = 0x165667B19E3779F9ull;
+constexpr uint64_t prime64_4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t prime64_5 = 0x27D4EB2F165667C5ull;
+
+// Buffers larger than the block are hashed block by block in parallel.
+// Must not be changed, otherwise hashes of the cached models become different.
+constexpr size_t block_size = 1 << 20;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read_u64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read_u32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t round(uint64_t acc, uint64_t input) {
+    acc += input * prime64_2;
+    acc = rotl(acc, 31);
+    return acc * prime64_1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t val) {
+    acc ^= round(0, val);
+    return acc * prime64_1 + prime64_4;
+}
+
+uint64_t xxh64(const uint8_t* p, size_t size, uint64_t seed) {
+    const uint8_t* const end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        // four independent accumulators let the CPU process 32 bytes per iteration in parallel
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + prime64_1 + prime64_2;
+        uint64_t v2 = seed + prime64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime64_1;
+        do {
+            v1 = round(v1, read_u64(p));
+            v2 = round(v2, read_u64(p + 8));
+            v3 = round(v3, read_u64(p + 16));
+            v4 = round(v4, read_u64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge_round(h, v1);
+        h = merge_round(h, v2);
+        h = merge_round(h, v3);
+        h = merge_round(h, v4);
+    } else {
+        h = seed + prime64_5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= round(0, read_u64(p));
+        h = rotl(h, 27) * prime64_1 + prime64_4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read_u32(p)) * prime64_1;
+        h = rotl(h, 23) * prime64_2 + prime64_3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<uint64_t>(*p) * prime64_5;
+        h = rotl(h, 11) * prime64_1;
+    }
+
+    h ^= h >> 33;
+    h *= prime64_2;
+    h ^= h >> 29;
+    h *= prime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // namespace
+
+uint64_t compute_hash(const void* src, size_t size) {
+    const auto data = static_cast<const uint8_t*>(src);
+    if (size <= block_size) {
+        return xxh64(data, size, 0);
+    }
+
+    const size_t blocks_num = (size + block_size - 1) / block_size;
+    std::vector<uint64_t> block_hashes(blocks_num);
+    ov::parallel_for(blocks_num, [&](size_t i) {
+        const size_t offset = i * block_size;
+        const size_t len = std::min(block_size, size - offset);
+        block_hashes[i] = xxh64(data + offset, len, i);
+    });
+    return xxh64(reinterpret_cast<const uint8_t*>(block_hashes.data()),
+                 block_hashes.size() * sizeof(uint64_t),
+                 static_cast<uint64_t>(size));
+}
+
+}  // namespace runtime
+}  // namespace ov
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/compute_hash.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ov::runtime;
+
+namespace {
+std::vector<uint8_t> make_data(size_t size) {
+    std::vector<uint8_t> data(size);
+    uint32_t state = 1;
+    for (auto& value : data) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+// Hash used by ModelCache::compute_hash for the model in memory before compute_hash was introduced
+uint64_t legacy_hash(const void* src, size_t size) {
+    auto combine = [](uint64_t seed, size_t v) {
+        return seed ^ (std::hash<size_t>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+    uint64_t seed = 0;
+    auto ptr = static_cast<const size_t*>(src);
+    const size_t words = size / sizeof(size_t);
+    for (size_t i = 0; i < words; i++)
+        seed = combine(seed, ptr[i]);
+    auto ptr_left = static_cast<const uint8_t*>(src) + words * sizeof(size_t);
+    for (size_t i = 0; i < size - words * sizeof(size_t); i++)
+        seed = combine(seed, ptr_left[i]);
+    return seed;
+}
+}  // namespace
+
+TEST(compute_hash, xxh64_reference_values) {
+    // digests of the reference XXH64 implementation with zero seed
+    EXPECT_EQ(compute_hash("", 0), 0xEF46DB3751D8E999ull);
+    EXPECT_EQ(compute_hash("a", 1), 0xD24EC4F1A98C6E5Bull);
+    EXPECT_EQ(compute_hash("abc", 3), 0x44BC2CF5AD770999ull);
+}
+
+TEST(compute_hash, same_content) {
+    const auto data = make_data(1000);
+    const auto copy = data;
+    EXPECT_EQ(compute_hash(data.data(), data.size()), compute_hash(copy.data(), copy.size()));
+}
+
+TEST(compute_hash, content_sensitive) {
+    // the sum of the words is the same, the weak hashes can't distinguish such buffers
+    const std::vector<uint8_t> first = {2, 2, 0, 0};
+    const std::vector<uint8_t> second = {0, 0, 2, 2};
+    EXPECT_NE(compute_hash(first.data(), first.size()), compute_hash(second.data(), second.size()));
+
+    for (size_t size : {1, 7, 8, 33, 100}) {
+        auto data = make_data(size);
+        const auto hash = compute_hash(data.data(), data.size());
+        data.back() ^= 1;
+        EXPECT_NE(hash, compute_hash(data.data(), data.size())) << "size: " << size;
+    }
+}
+
+TEST(compute_hash, size_sensitive) {
+    const std::vector<uint8_t> zeros(64, 0);
+    EXPECT_NE(compute_hash(zeros.data(), 32), compute_hash(zeros.data(), 64));
+    EXPECT_NE(compute_hash(zeros.data(), 0), compute_hash(zeros.data(), 1));
+}
+
+TEST(compute_hash, large_buffer) {
+    // several parallel blocks with an incomplete last one
+    auto data = make_data((3 << 20) + 123);
+    const auto hash = compute_hash(data.data(), data.size());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(hash, compute_hash(data.data(), data.size()));
+    }
+
+    // swapped blocks must not give the same hash
+    auto swapped = data;
+    std::memcpy(swapped.data(), data.data() + (1 << 20), 1 << 20);
+    std::memcpy(swapped.data() + (1 << 20), data.data(), 1 << 20);
+    EXPECT_NE(hash, compute_hash(swapped.data(), swapped.size()));
+
+    data.back() ^= 1;
+    EXPECT_NE(hash, compute_hash(data.data(), data.size()));
+}
+
+TEST(compute_hash, DISABLED_benchmark) {
+    using namespace std::chrono;
+    const auto data = make_data(size_t(512) << 20);
+
+    auto measure = [&](uint64_t (*hash)(const void*, size_t)) {
+        const auto start = high_resolution_clock::now();
+        volatile uint64_t result = hash(data.data(), data.size());
+        (void)result;
+        return duration_cast<milliseconds>(high_resolution_clock::now() - start).count();
+    };
+
+    const auto legacy_ms = measure(legacy_hash);
+    const auto new_ms = measure(compute_hash);
+    std::cout << "Hash of " << (data.size() >> 20) << " MB: legacy " << legacy_ms << " ms, compute_hash " << new_ms
+              << " ms" << std::endl;
+}
@@ -6,11 +6,15 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <random>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 using namespace std;
 using namespace ov;
 
@@ -167,3 +171,22 @@ TEST_F(TrimFileTest, relatice_path_to_source_forward_slash_always_supported) {
     auto str_ptr = ov::util::trim_file_name(file_path.c_str());
     EXPECT_EQ(exp_path, str_ptr);
 }
+
+TEST(file_util, replace_mapped_file) {
+    const auto prefix = ov::test::utils::generateTestFilePrefix();
+    const auto path = prefix + "_file.bin";
+    const auto new_path = prefix + "_file.bin.tmp";
+    ov::util::save_binary(path, std::vector<uint8_t>(16, 1));
+    {
+        auto mapped_memory = ov::load_mmap_object(path);
+        ov::util::save_binary(new_path, std::vector<uint8_t>(32, 2));
+        ASSERT_TRUE(ov::util::replace_file(new_path, path));
+        // the mapping keeps the content of the replaced file
+        ASSERT_EQ(mapped_memory->size(), 16);
+        for (size_t i = 0; i < mapped_memory->size(); i++)
+            EXPECT_EQ(mapped_memory->data()[i], 1);
+    }
+    EXPECT_FALSE(ov::util::file_exists(new_path));
+    EXPECT_EQ(ov::util::load_binary(path), std::vector<uint8_t>(32, 2));
+    std::remove(path.c_str());
+}
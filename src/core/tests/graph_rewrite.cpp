@@ -267,6 +267,22 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndAnyTypeMatcherPasses) {
+    auto f = get_model();
+    auto ref_order = f->get_ordered_ops();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    // the matcher with unknown root type is applied to all the nodes
+    // and doesn't prevent the type based one from being applied
+    ASSERT_EQ(order, ref_order);
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
@@ -14,6 +14,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/validate.hpp"
 
 TEST(model, get_input_by_tensor_name) {
     auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
@@ -1479,11 +1480,73 @@ TEST(model, topological_sort_caching_replace_source_output) {
     auto shared_info = ov::ModelAccessor(f).get_shared_info();
     ASSERT_TRUE(shared_info->get_use_topological_cache());
 
-    relu2->input(0).replace_source_output(relu1);
+    relu2->input(0).replace_source_output(arg0);
 
     // model has changed so cache must be updated
     ASSERT_FALSE(shared_info->get_use_topological_cache());
 
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_replace_same_source_output) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    relu2->input(0).replace_source_output(relu1);
+
+    // model has not changed so cache mustn't be updated
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+}
+
+TEST(model, topological_sort_caching_destroyed_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    relu2->input(0).replace_source_output(arg0);
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // relu1 is not in the model anymore, so its destruction doesn't change the order
+    relu1.reset();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(model, topological_sort_caching_remove_cf) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    relu2->add_control_dependency(relu1);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // relu1 is reachable only through the control dependency
+    relu2->remove_control_dependency(relu1);
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // the dependency on the node outside of the model changes the order as well
+    auto relu3 = std::make_shared<ov::opset8::Relu>(arg0);
+    relu2->add_control_dependency(relu3);
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
     ASSERT_EQ(f->get_ordered_ops().size(), 4);
     ASSERT_TRUE(shared_info->get_use_topological_cache());
     ASSERT_TRUE(all_ops_have_same_info(f));
@@ -2135,3 +2198,101 @@ TEST(model, create_model) {
     EXPECT_THROW(ov::Model(ov::ResultVector{}, {}, {}, {nullptr}, ""), ov::Exception);
     EXPECT_THROW(ov::Model(ov::OutputVector{ov::Output<ov::Node>{nullptr, 0}}, {}, {}, {}, ""), ov::Exception);
 }
+
+TEST(model, validate_only_modified_nodes) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    auto abs = std::make_shared<ov::opset8::Abs>(relu);
+    auto neg = std::make_shared<ov::opset8::Negative>(param);
+    auto result1 = std::make_shared<ov::opset8::Result>(abs);
+    auto result2 = std::make_shared<ov::opset8::Result>(neg);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result1, result2}, ov::ParameterVector{param});
+
+    model->validate_nodes_and_infer_types();
+    for (const auto& node : model->get_ordered_ops())
+        EXPECT_FALSE(node->is_validation_required()) << node;
+
+    // only the replaced node and the nodes downstream of it are revalidated
+    auto new_relu = std::make_shared<ov::opset8::Relu>(param);
+    relu->output(0).replace(new_relu);
+    EXPECT_TRUE(abs->is_validation_required());
+    EXPECT_FALSE(neg->is_validation_required());
+
+    ov::pass::Validate validate(true);
+    validate.run_on_model(model);
+    // the parameter is always revalidated
+    EXPECT_EQ(validate.get_validated_nodes(), size_t{4});
+    for (const auto& node : model->get_ordered_ops())
+        EXPECT_FALSE(node->is_validation_required()) << node;
+}
+
+TEST(model, validate_nodes_downstream_of_changed_values) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 6});
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{6});
+    auto shape_of = std::make_shared<ov::opset8::ShapeOf>(param);
+    auto reshape = std::make_shared<ov::opset8::Reshape>(data, shape_of, false);
+    auto result = std::make_shared<ov::opset8::Result>(reshape);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param, data});
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(reshape->get_output_partial_shape(0), (ov::PartialShape{1, 6}));
+
+    // the output shape of ShapeOf remains the same, but its value is changed
+    param->set_partial_shape({2, 3});
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(shape_of->get_output_partial_shape(0), (ov::PartialShape{2}));
+    EXPECT_EQ(reshape->get_output_partial_shape(0), (ov::PartialShape{2, 3}));
+    EXPECT_EQ(result->get_output_partial_shape(0), (ov::PartialShape{2, 3}));
+}
+
+namespace {
+std::shared_ptr<ov::Model> make_convolution_model() {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 224, 224});
+    auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{8, 3, 1, 1}, {1.f});
+    auto conv = std::make_shared<ov::opset8::Convolution>(param,
+                                                          weights,
+                                                          ov::Strides{1, 1},
+                                                          ov::CoordinateDiff{0, 0},
+                                                          ov::CoordinateDiff{0, 0},
+                                                          ov::Strides{1, 1});
+    auto relu = std::make_shared<ov::opset8::Relu>(conv);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    model->validate_nodes_and_infer_types();
+    return model;
+}
+
+std::shared_ptr<ov::opset8::Convolution> get_convolution(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto conv = ov::as_type_ptr<ov::opset8::Convolution>(node))
+            return conv;
+    }
+    return nullptr;
+}
+}  // namespace
+
+TEST(model, validate_attribute_change_without_revalidation) {
+    auto model = make_convolution_model();
+    auto conv = get_convolution(model);
+    ASSERT_NE(conv, nullptr);
+
+    // the strides are changed the same way as StridesOptimization does, without validate_and_infer_types()
+    conv->set_strides({2, 2});
+    EXPECT_FALSE(conv->is_validation_required());
+    ov::pass::Validate().run_on_model(model);
+    EXPECT_EQ(conv->get_output_partial_shape(0), (ov::PartialShape{1, 8, 112, 112}));
+    EXPECT_EQ(model->get_output_partial_shape(0), (ov::PartialShape{1, 8, 112, 112}));
+}
+
+TEST(model, incremental_validation_of_marked_attribute_change) {
+    auto model = make_convolution_model();
+    auto conv = get_convolution(model);
+    ASSERT_NE(conv, nullptr);
+
+    conv->set_strides({2, 2});
+    conv->set_validation_required();
+    ov::pass::Validate validate(true);
+    validate.run_on_model(model);
+    // the parameter, the convolution, the relu and the result
+    EXPECT_EQ(validate.get_validated_nodes(), size_t{4});
+    EXPECT_EQ(model->get_output_partial_shape(0), (ov::PartialShape{1, 8, 112, 112}));
+}
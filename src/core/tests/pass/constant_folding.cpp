@@ -3930,3 +3930,45 @@ TEST(constant_folding, parameter_with_unspecified_type_from_host_tensor) {
     auto model = std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{param});
     EXPECT_NO_THROW(run_constant_folding(model));
 }
+
+class constant_folding_threads : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(constant_folding_threads, independent_subgraphs) {
+    constexpr size_t num_subgraphs = 64;
+    ResultVector results;
+    for (size_t i = 0; i < num_subgraphs; ++i) {
+        auto data = op::v0::Constant::create(element::i32, Shape{2}, {static_cast<int>(i), -static_cast<int>(i)});
+        data->set_friendly_name("data_" + std::to_string(i));
+        auto one = op::v0::Constant::create(element::i32, Shape{1}, {1});
+        one->set_friendly_name("one_" + std::to_string(i));
+        auto add = make_shared<op::v1::Add>(data, one);
+        add->set_friendly_name("add_" + std::to_string(i));
+        auto two = op::v0::Constant::create(element::i32, Shape{1}, {2});
+        two->set_friendly_name("two_" + std::to_string(i));
+        auto multiply = make_shared<op::v1::Multiply>(add, two);
+        multiply->set_friendly_name("test_" + std::to_string(i));
+        results.push_back(make_shared<op::v0::Result>(multiply));
+    }
+    auto model = make_shared<Model>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<pass::ConstantFolding>(GetParam());
+    pass_manager.run_passes(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    for (size_t i = 0; i < num_subgraphs; ++i) {
+        const auto idx = std::to_string(i);
+        auto result_node = get_result_constant(model, i);
+        ASSERT_TRUE(result_node);
+        const vector<int> expected{2 * static_cast<int>(i) + 2, 2 - 2 * static_cast<int>(i)};
+        ASSERT_EQ(expected, result_node->cast_vector<int>());
+        check_names(result_node,
+                    {"data_" + idx, "one_" + idx, "add_" + idx, "two_" + idx, "test_" + idx},
+                    "test_" + idx);
+    }
+}
+
+// 0 - all the available threads, 1 - the serial folding
+INSTANTIATE_TEST_SUITE_P(constant_folding, constant_folding_threads, ::testing::Values(0, 1, 3));
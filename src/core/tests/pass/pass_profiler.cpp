@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/abs.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov;
+
+namespace {
+void set_report_path(const std::string& path) {
+#ifdef _WIN32
+    _putenv(("OV_PROFILE_PASS_REPORT=" + path).c_str());
+#else
+    if (path.empty())
+        ::unsetenv("OV_PROFILE_PASS_REPORT");
+    else
+        ::setenv("OV_PROFILE_PASS_REPORT", path.c_str(), 1);
+#endif
+}
+
+class RemoveRelu : public pass::MatcherPass {
+public:
+    OPENVINO_RTTI("RemoveRelu");
+    RemoveRelu() {
+        auto relu = pass::pattern::wrap_type<op::v0::Relu>();
+        matcher_pass_callback callback = [](pass::pattern::Matcher& m) {
+            auto relu = m.get_match_root();
+            relu->output(0).replace(relu->input_value(0));
+            return true;
+        };
+        register_matcher(std::make_shared<pass::pattern::Matcher>(relu, "RemoveRelu"), callback);
+    }
+};
+
+class RemoveReluNested : public pass::ModelPass {
+public:
+    OPENVINO_RTTI("RemoveReluNested");
+    bool run_on_model(const std::shared_ptr<Model>& model) override {
+        pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<RemoveRelu>();
+        return manager.run_passes(model);
+    }
+};
+
+class DoNothing : public pass::ModelPass {
+public:
+    OPENVINO_RTTI("DoNothing");
+    bool run_on_model(const std::shared_ptr<Model>&) override {
+        return false;
+    }
+};
+
+std::shared_ptr<Model> make_model() {
+    auto param = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+    auto relu = std::make_shared<op::v0::Relu>(param);
+    auto abs = std::make_shared<op::v0::Abs>(relu);
+    return std::make_shared<Model>(abs, ParameterVector{param});
+}
+
+std::vector<std::string> run_with_report(const std::string& path) {
+    set_report_path(path);
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<RemoveReluNested>();
+    manager.register_pass<DoNothing>();
+    manager.run_passes(make_model());
+    set_report_path({});
+
+    std::vector<std::string> lines;
+    std::ifstream report(path);
+    for (std::string line; std::getline(report, line);)
+        lines.push_back(line);
+    report.close();
+    std::remove(path.c_str());
+    return lines;
+}
+
+bool contains(const std::string& str, const std::string& substr) {
+    return str.find(substr) != std::string::npos;
+}
+
+std::vector<std::string> split_csv(const std::string& line) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    for (std::string field; std::getline(stream, field, ',');)
+        fields.push_back(field);
+    return fields;
+}
+}  // namespace
+
+TEST(pass_profiler, json_report) {
+    const auto lines = run_with_report(ov::test::utils::generateTestFilePrefix() + "_passes.json");
+    // the nested manager run is a part of the outermost report
+    ASSERT_EQ(lines.size(), 1);
+    const auto& report = lines[0];
+    EXPECT_EQ(report.find("{\"name\":\"pass::Manager\",\"kind\":\"manager\""), 0);
+    // the Relu is removed from Parameter, Relu, Abs and Result
+    EXPECT_TRUE(contains(report, "\"applied\":true,\"nodes_before\":4,\"nodes_after\":3"));
+    EXPECT_TRUE(contains(report, "RemoveReluNested\",\"kind\":\"pass\""));
+    EXPECT_TRUE(contains(report, "RemoveRelu\",\"kind\":\"pass\""));
+    EXPECT_TRUE(contains(report, "RemoveRelu\",\"kind\":\"matcher\""));
+    EXPECT_TRUE(contains(report, "\"hits\":1,\"misses\":0"));
+    EXPECT_TRUE(contains(report, "DoNothing\",\"kind\":\"pass\""));
+    EXPECT_TRUE(contains(report, "\"applied\":false,\"nodes_before\":3,\"nodes_after\":3"));
+}
+
+TEST(pass_profiler, csv_report) {
+    const auto lines = run_with_report(ov::test::utils::generateTestFilePrefix() + "_passes.csv");
+    // the header, the managers, the passes and the matcher
+    ASSERT_EQ(lines.size(), 7);
+    EXPECT_EQ(lines[0], "path,kind,time_ms,applied,nodes_before,nodes_after,memory_delta_kb,hits,misses");
+    std::vector<std::vector<std::string>> rows;
+    for (size_t i = 1; i < lines.size(); ++i) {
+        rows.push_back(split_csv(lines[i]));
+        ASSERT_EQ(rows.back().size(), 9) << lines[i];
+    }
+    // the rows of a report go in the depth-first order, the path lists the enclosing passes
+    EXPECT_EQ(rows[0][0], "pass::Manager");
+    std::vector<std::string> kinds;
+    for (const auto& row : rows) {
+        EXPECT_EQ(row[0].find("pass::Manager"), 0) << row[0];
+        kinds.push_back(row[1]);
+    }
+    EXPECT_EQ(kinds, (std::vector<std::string>{"manager", "pass", "manager", "pass", "matcher", "pass"}));
+    // nodes_before and nodes_after of the outermost manager
+    EXPECT_EQ(rows[0][4], "4");
+    EXPECT_EQ(rows[0][5], "3");
+    // hits and misses of the matcher
+    EXPECT_TRUE(contains(rows[4][0], "RemoveRelu"));
+    EXPECT_EQ(rows[4][7], "1");
+    EXPECT_EQ(rows[4][8], "0");
+}
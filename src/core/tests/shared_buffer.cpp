@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/shared_buffer.hpp"
+
+#include <istream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace ov;
+
+namespace {
+std::shared_ptr<AlignedBuffer> make_buffer(const std::string& content) {
+    auto buffer = std::make_shared<AlignedBuffer>(content.size());
+    std::copy(content.begin(), content.end(), buffer->get_ptr<char>());
+    return buffer;
+}
+}  // namespace
+
+TEST(shared_stream_buffer, read) {
+    const std::string content = "first line\nsecond line";
+    SharedStreamBuffer buf(make_buffer(content));
+    std::istream stream(&buf);
+
+    std::string line;
+    std::getline(stream, line);
+    EXPECT_EQ(line, "first line");
+    EXPECT_EQ(stream.tellg(), 11);
+    std::getline(stream, line);
+    EXPECT_EQ(line, "second line");
+    EXPECT_TRUE(stream.eof());
+}
+
+TEST(shared_stream_buffer, seek) {
+    const std::string content = "0123456789";
+    SharedStreamBuffer buf(make_buffer(content));
+    std::istream stream(&buf);
+
+    char data[3] = {};
+    stream.seekg(5);
+    stream.read(data, sizeof(data));
+    EXPECT_EQ(std::string(data, sizeof(data)), "567");
+
+    stream.seekg(-2, std::ios_base::end);
+    stream.read(data, 2);
+    EXPECT_EQ(std::string(data, 2), "89");
+
+    stream.seekg(0, std::ios_base::beg);
+    stream.seekg(1, std::ios_base::cur);
+    EXPECT_EQ(stream.tellg(), 1);
+
+    stream.seekg(100);
+    EXPECT_TRUE(stream.fail());
+}
+
+TEST(shared_stream_buffer, get_buffer) {
+    auto buffer = make_buffer("data");
+    SharedStreamBuffer buf(buffer);
+    EXPECT_EQ(buf.get_buffer(), buffer);
+}
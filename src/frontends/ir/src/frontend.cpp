@@ -58,6 +58,12 @@ size_t get_ir_version(std::istream& model) {
     return 0;
 }
 
+#if defined(__linux__)
+constexpr bool mmap_weights_by_default = true;
+#else
+constexpr bool mmap_weights_by_default = false;
+#endif
+
 }  // namespace
 
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
@@ -183,7 +189,11 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             weights = variant.as<std::shared_ptr<ov::AlignedBuffer>>();
         }
     }
-    bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
+    // If the caller did not say whether `mmap` is desired, weights are mapped on Linux:
+    // constants then point directly into the page cache and processes serving the same
+    // model share physical pages instead of holding private copies of the .bin file
+    bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>()
+                                                                 : mmap_weights_by_default;
 
     // Find weights if only path to xml was provided
     if (weights_path.empty()) {
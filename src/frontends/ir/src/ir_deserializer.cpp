@@ -10,6 +10,7 @@
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/loop.hpp"
@@ -17,9 +18,11 @@
 #include "openvino/op/result.hpp"
 #include "openvino/op/util/assign_base.hpp"
 #include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
 #include "openvino/op/util/variable.hpp"
+#include "openvino/op/util/variable_extension.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "rt_info_deserializer.hpp"
@@ -432,13 +435,31 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
+    // Parse the layers in parallel, the errors are rethrown in the order of the layers
+    std::vector<pugi::xml_node> layers;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layers.push_back(node); }
+    std::vector<GenericLayerParams> layers_params(layers.size());
+    std::vector<std::exception_ptr> errors(layers.size());
+    ov::parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layers_params[i] = parse_generic_params(layers[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    // Store the layers parameters in params map
+    for (size_t i = 0; i < layers.size(); ++i) {
+        const auto& node = layers[i];
+        auto& node_param = layers_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             OPENVINO_THROW("Invalid IR! ", node_param.name, " name is not unique!");
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        params[node_param.layerId] = {node, std::move(node_param)};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -476,8 +497,24 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
 
-    //  Following topological order create OpenVINO operations
-    for (auto& layer_id : order) {
+    // Visiting the attributes is independent of the inputs, so the operations are prepared in parallel
+    std::vector<PreparedNode> prepared(order.size());
+    ov::parallel_for(order.size(), [&](size_t i) {
+        const auto layer_id = order[i];
+        if (edges.find(layer_id) == edges.end())
+            return;
+        const auto& p = params.at(layer_id);
+        try {
+            prepared[i] = prepare_node(p.xml, weights, p.params);
+        } catch (...) {
+            // the operation is created from scratch, so create_node reports the error if any
+            prepared[i] = {};
+        }
+    });
+
+    //  Following topological order connect the prepared operations or create them
+    for (size_t order_idx = 0; order_idx < order.size(); ++order_idx) {
+        const auto layer_id = order[order_idx];
         auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
@@ -500,7 +537,7 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
+        auto node = create_node(inputs, p.xml, weights, p.params, std::move(prepared[order_idx]));
         id_to_node[layer_id] = node;
 
         if (const auto& parameter_node = std::dynamic_pointer_cast<ov::op::v0::Parameter>(node)) {
@@ -744,10 +781,81 @@ static const std::string& translate_type_name(const std::string& name) {
     return name;
 }
 
+const ov::OpSet* ov::XmlDeserializer::find_opset(const GenericLayerParams& params,
+                                                  const std::string& type_name) const {
+    // Find registered opset
+    auto opsetIt = m_opsets.find(params.version);
+
+    // Try to create operation from loaded opsets
+    static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
+        "ExperimentalDetectronDetectionOutput",
+        "ExperimentalDetectronGenerateProposalsSingleImage",
+        "ExperimentalDetectronPriorGridGenerator",
+        "ExperimentalDetectronROIFeatureExtractor",
+        "ExperimentalDetectronTopKROIs",
+        "GRUCell",
+        "RNNCell",
+        "Proposal"};
+
+    if (experimental_ops_added_to_opset.count(type_name) &&
+        (params.version == "experimental" || params.version == "extension")) {
+        opsetIt = m_opsets.find("opset6");
+    }
+
+    if (opsetIt == m_opsets.end())
+        return nullptr;
+
+    if (params.version == "opset1") {
+        // MVN, ROIPooling and ReorgYolo were missing in opset1
+        if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
+            opsetIt = m_opsets.find("opset2");
+            if (opsetIt == m_opsets.end()) {
+                OPENVINO_THROW("Cannot create ",
+                               params.type,
+                               " layer ",
+                               params.name,
+                               " id:",
+                               params.layerId,
+                               " from unsupported opset: ",
+                               params.version);
+            }
+        }
+    }
+    return &opsetIt->second;
+}
+
+ov::XmlDeserializer::PreparedNode ov::XmlDeserializer::prepare_node(const pugi::xml_node& node,
+                                                                    const std::shared_ptr<ov::AlignedBuffer>& weights,
+                                                                    const GenericLayerParams& params) {
+    const std::string& type_name = translate_type_name(params.type);
+    if (m_extensions.count(ov::DiscreteTypeInfo(type_name.c_str(), params.version.c_str())))
+        return {};
+
+    const auto opset = find_opset(params, type_name);
+    if (!opset || !opset->contains_type_insensitive(type_name))
+        return {};
+
+    PreparedNode prepared;
+    prepared.node = std::shared_ptr<ov::Node>(opset->create_insensitive(type_name));
+    // The sub-graphs share the state of the deserializer and the variables are shared between the operations
+    if (!prepared.node || std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(prepared.node) ||
+        std::dynamic_pointer_cast<ov::op::util::VariableExtension>(prepared.node))
+        return {};
+
+    // Share Weights form constant blob
+    if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(prepared.node)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+    prepared.attributes_visited = prepared.node->visit_attributes(visitor);
+    return prepared;
+}
+
 std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov::Output<ov::Node>>& inputs,
                                                            const pugi::xml_node& node,
                                                            const std::shared_ptr<ov::AlignedBuffer>& weights,
-                                                           const GenericLayerParams& params) {
+                                                           const GenericLayerParams& params,
+                                                           PreparedNode prepared) {
     // Check that inputs are correctly defined
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
@@ -781,57 +889,28 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
         ovNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
     }
 
-    // Find registered opset
-    auto opsetIt = m_opsets.find(params.version);
-
-    // Try to create operation from loaded opsets
-    static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
-        "ExperimentalDetectronDetectionOutput",
-        "ExperimentalDetectronGenerateProposalsSingleImage",
-        "ExperimentalDetectronPriorGridGenerator",
-        "ExperimentalDetectronROIFeatureExtractor",
-        "ExperimentalDetectronTopKROIs",
-        "GRUCell",
-        "RNNCell",
-        "Proposal"};
-
-    if (experimental_ops_added_to_opset.count(type_name) &&
-        (params.version == "experimental" || params.version == "extension")) {
-        opsetIt = m_opsets.find("opset6");
-    }
-
-    if (!ovNode && opsetIt != m_opsets.end()) {
-        if (params.version == "opset1") {
-            // MVN, ROIPooling and ReorgYolo were missing in opset1
-            if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
-                opsetIt = m_opsets.find("opset2");
-                if (opsetIt == m_opsets.end()) {
-                    OPENVINO_THROW("Cannot create ",
-                                   params.type,
-                                   " layer ",
-                                   params.name,
-                                   " id:",
-                                   params.layerId,
-                                   " from unsupported opset: ",
-                                   params.version);
-                }
+    const auto opset = ovNode ? nullptr : find_opset(params, type_name);
+    if (opset) {
+        bool attributes_visited = false;
+        if (prepared.node) {
+            ovNode = std::move(prepared.node);
+            ovNode->set_arguments(inputs);
+            attributes_visited = prepared.attributes_visited;
+        } else {
+            ovNode = std::shared_ptr<ov::Node>(opset->create_insensitive(type_name));
+            if (!ovNode) {
+                OPENVINO_THROW("Opset ", params.version, " doesn't contain the operation with type: ", type_name);
             }
+            // Share Weights form constant blob
+            if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(ovNode)) {
+                constant->alloc_buffer_on_visit_attributes(false);
+            }
+            ovNode->set_arguments(inputs);
+            XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+            attributes_visited = ovNode->visit_attributes(visitor);
         }
 
-        auto const& opset = opsetIt->second;
-
-        ovNode = std::shared_ptr<ov::Node>(opset.create_insensitive(type_name));
-        if (!ovNode) {
-            OPENVINO_THROW("Opset ", params.version, " doesn't contain the operation with type: ", type_name);
-        }
-        // Share Weights form constant blob
-        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(ovNode)) {
-            constant->alloc_buffer_on_visit_attributes(false);
-        }
-        ovNode->set_arguments(inputs);
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
-
-        if (ovNode->visit_attributes(visitor)) {
+        if (attributes_visited) {
             ovNode->constructor_validate_and_infer_types();
         }
 
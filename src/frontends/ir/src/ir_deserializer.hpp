@@ -175,10 +175,27 @@ private:
 
     GenericLayerParams parse_generic_params(const pugi::xml_node& node);
 
+    /// \brief Operation created from opset with visited attributes, but not connected to the inputs yet
+    struct PreparedNode {
+        std::shared_ptr<ov::Node> node;
+        bool attributes_visited = false;
+    };
+
+    /// \brief Returns opset to create the layer operation from, or nullptr if there is no such opset
+    const ov::OpSet* find_opset(const GenericLayerParams& params, const std::string& type_name) const;
+
+    /// \brief Creates the layer operation and visits its attributes without the inputs, so it can be done
+    /// concurrently for the layers of the model. Returns empty node if the operation has to be created
+    /// by create_node (extensions, framework nodes, sub-graphs and operations with variables).
+    PreparedNode prepare_node(const pugi::xml_node& node,
+                              const std::shared_ptr<ov::AlignedBuffer>& weights,
+                              const GenericLayerParams& params);
+
     std::shared_ptr<ov::Node> create_node(const ov::OutputVector& inputs,
                                           const pugi::xml_node& node,
                                           const std::shared_ptr<ov::AlignedBuffer>& weights,
-                                          const GenericLayerParams& params);
+                                          const GenericLayerParams& params,
+                                          PreparedNode prepared = {});
 
     void read_meta_data(const std::shared_ptr<ov::Model>& model, const pugi::xml_node& meta_section);
 
@@ -67,6 +67,36 @@ TEST_F(IRFrontendMMapTestsAdvanced, core_enable_mmap_property) {
         EXPECT_EXIT(test(is_mmap), ::testing::ExitedWithCode(0), "Test passed");
 }
 
+#ifdef __linux__
+TEST_F(IRFrontendMMapTestsAdvanced, fe_mmap_ir_by_default) {
+    // Test checks that IR FE uses `mmap` by default on Linux,
+    // so .bin file should not be loaded to RAM
+
+    auto test = [&]() {
+        ov::frontend::InputModel::Ptr input_model;
+        std::shared_ptr<ov::Model> model;
+
+        auto rss_init = ov::test::utils::getVmRSSInKB();
+        auto FE = manager.load_by_model(xmlFileName);
+        if (FE)
+            input_model = FE->load(xmlFileName);
+        if (input_model)
+            model = FE->convert(input_model);
+        auto rss_read = ov::test::utils::getVmRSSInKB();
+
+        bool is_weights_mapped = (rss_read - rss_init) < REF_RSS;
+        if (!is_weights_mapped) {
+            std::cerr << "Test failed: weights are not mapped; RAM consumption is more than expected" << std::endl;
+            exit(1);
+        }
+        std::cerr << "Test passed" << std::endl;
+        exit(0);
+    };
+
+    // Run test in a separate process to not affect RAM values by previous tests
+    ASSERT_EXIT(test(), ::testing::ExitedWithCode(0), "Test passed");
+}
+#else
 TEST_F(IRFrontendMMapTestsAdvanced, fe_read_ir_by_default) {
     // Test checks that IR FE `read` IR by default,
     // so .bin file should be loaded to RAM
@@ -95,6 +125,36 @@ TEST_F(IRFrontendMMapTestsAdvanced, fe_read_ir_by_default) {
     // Run test in a separate process to not affect RAM values by previous tests
     ASSERT_EXIT(test(), ::testing::ExitedWithCode(0), "Test passed");
 }
+#endif
+
+TEST_F(IRFrontendMMapTestsAdvanced, fe_read_ir_with_disabled_mmap) {
+    // Test checks that IR FE reads .bin file into RAM
+    // when `mmap` is explicitly disabled
+
+    auto test = [&]() {
+        ov::frontend::InputModel::Ptr input_model;
+        std::shared_ptr<ov::Model> model;
+
+        auto rss_init = ov::test::utils::getVmRSSInKB();
+        auto FE = manager.load_by_model(xmlFileName);
+        if (FE)
+            input_model = FE->load(xmlFileName, false);
+        if (input_model)
+            model = FE->convert(input_model);
+        auto rss_read = ov::test::utils::getVmRSSInKB();
+
+        bool is_weights_read = (rss_read - rss_init) > REF_RSS;
+        if (!is_weights_read) {
+            std::cerr << "Test failed: weights are not read; RAM consumption is less than expected" << std::endl;
+            exit(1);
+        }
+        std::cerr << "Test passed" << std::endl;
+        exit(0);
+    };
+
+    // Run test in a separate process to not affect RAM values by previous tests
+    ASSERT_EXIT(test(), ::testing::ExitedWithCode(0), "Test passed");
+}
 
 TEST_F(IRFrontendMMapTestsAdvanced, core_mmap_ir_by_default) {
     // Test checks that Core uses `mmap` by default,
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#include "common_test_utils/graph_comparator.hpp"
+#include "openvino/op/ops.hpp"
+#include "openvino/openvino.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+
+class LargeModelDeserialization : public ::testing::Test {
+protected:
+    ov::Core core;
+
+    // Generates the model of the blocks, each one has a few branches with own weights,
+    // so the layers of the block are independent of each other besides the edges
+    static std::shared_ptr<ov::Model> generate_model(size_t num_blocks) {
+        const ov::Shape shape{1, 8};
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        param->set_friendly_name("input");
+        ov::Output<ov::Node> last = param;
+        for (size_t i = 0; i < num_blocks; ++i) {
+            const auto suffix = "_" + std::to_string(i);
+            std::vector<float> weights(ov::shape_size(shape), static_cast<float>(i % 7) / 7);
+            auto mul_const = ov::op::v0::Constant::create(ov::element::f32, shape, weights);
+            mul_const->set_friendly_name("mul_const" + suffix);
+            auto mul = std::make_shared<ov::op::v1::Multiply>(last, mul_const);
+            mul->set_friendly_name("mul" + suffix);
+            auto relu = std::make_shared<ov::op::v0::Relu>(mul);
+            relu->set_friendly_name("relu" + suffix);
+            auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(last);
+            sigmoid->set_friendly_name("sigmoid" + suffix);
+            auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{relu, sigmoid}, 1);
+            concat->set_friendly_name("concat" + suffix);
+            auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {1});
+            axis->set_friendly_name("axis" + suffix);
+            auto split = std::make_shared<ov::op::v1::Split>(concat, axis, 2);
+            split->set_friendly_name("split" + suffix);
+            auto add = std::make_shared<ov::op::v1::Add>(split->output(0), split->output(1));
+            add->set_friendly_name("add" + suffix);
+            add->get_output_tensor(0).set_names({"add" + suffix});
+            last = add;
+        }
+        auto result = std::make_shared<ov::op::v0::Result>(last);
+        result->set_friendly_name("output");
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "LargeModel");
+    }
+
+    static void serialize(const std::shared_ptr<ov::Model>& model, std::string& xml, ov::Tensor& weights) {
+        std::stringstream xml_stream, bin_stream;
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::Serialize>(xml_stream, bin_stream);
+        manager.run_passes(model);
+        xml = xml_stream.str();
+        const auto bin = bin_stream.str();
+        weights = ov::Tensor(ov::element::u8, ov::Shape{bin.size()});
+        std::copy(bin.begin(), bin.end(), static_cast<char*>(weights.data()));
+    }
+};
+
+TEST_F(LargeModelDeserialization, read_model) {
+    const auto model = generate_model(500);
+    std::string xml;
+    ov::Tensor weights;
+    serialize(model, xml, weights);
+
+    std::shared_ptr<ov::Model> read_model;
+    ASSERT_NO_THROW(read_model = core.read_model(xml, weights));
+    ASSERT_TRUE(read_model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(read_model, model);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+// Benchmark of the large IR reading, run with --gtest_also_run_disabled_tests
+TEST_F(LargeModelDeserialization, DISABLED_read_model_benchmark) {
+    // 8 layers per block
+    const auto model = generate_model(12500);
+    std::string xml;
+    ov::Tensor weights;
+    serialize(model, xml, weights);
+
+    constexpr size_t iterations = 3;
+    double best_time_ms = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto read_model = core.read_model(xml, weights);
+        const auto time_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(read_model->get_ops().size(), model->get_ops().size());
+        best_time_ms = i == 0 ? time_ms : std::min(best_time_ms, time_ms);
+    }
+    std::cout << "read_model of " << model->get_ops().size() << " layers: " << best_time_ms << " ms" << std::endl;
+}
@@ -4,6 +4,8 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <queue>
 
@@ -11,9 +13,12 @@
 #include "framework.pb.h"
 #include "input_model.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/opsets/opset7.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -54,8 +59,10 @@ public:
 
 private:
     void load_places();
+    std::vector<std::string> get_const_names() const;
     template <typename T>
     void load_consts(const std::basic_string<T>& folder_with_weights);
+    void load_consts(const std::shared_ptr<ov::MappedMemory>& weights);
     void load_consts(std::istream* weight_stream);
     void create_temp_consts();
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
@@ -184,16 +191,13 @@ bool is_pdmodel(const std::basic_string<wchar_t>& path) {
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_file) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -202,22 +206,36 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::wstring* weights_file) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file.c_str(), std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
     return model_file;
 }
 #endif
+
+std::shared_ptr<opset7::Constant> create_shared_constant(const element::Type& type,
+                                                         const Shape& shape,
+                                                         const std::shared_ptr<ov::MappedMemory>& weights,
+                                                         size_t offset,
+                                                         size_t size) {
+    const auto data = weights->data() + offset;
+    // the typed access to the shared data requires the alignment of the element type,
+    // the weights follow the headers of variable size, so the misaligned data is copied
+    const auto alignment = std::max(type.size(), size_t{1});
+    if (reinterpret_cast<uintptr_t>(data) % alignment != 0)
+        return std::make_shared<opset7::Constant>(type, shape, data);
+    return std::make_shared<opset7::Constant>(
+        type,
+        shape,
+        std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(data, size, weights));
+}
 }  // namespace
 
 std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::get_op_places(const int32_t blck_idx) const {
@@ -268,45 +286,114 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
     return new_op_places;
 }
 
-// load_consts with folder is compatible with old PaddlePaddle API.
-template <typename T>
-void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_with_weights) {
+std::vector<std::string> InputModel::InputModelImpl::get_const_names() const {
+    std::vector<std::string> names;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
         if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
             continue;
+
+        // var_desc.persistable() is used to mark node const value or not.
         if (!var_desc.persistable())
             continue;
 
         FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
-        const auto& tensor = var_desc.type().lod_tensor().tensor();
-        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
-        const auto& type = get_ov_type(tensor.data_type());
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
+        names.push_back(name);
+    }
+    return names;
+}
 
-        bool read_succeed = false;
-        if (!folder_with_weights.empty()) {
-            std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            const size_t header_size = 16;
-            std::vector<char> header(header_size);
-            is.read(&header[0], header_size);
+// load_consts with folder is compatible with old PaddlePaddle API.
+template <typename T>
+void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_with_weights) {
+    FRONT_END_GENERAL_CHECK(!folder_with_weights.empty(), "Folder with weights must be provided.");
+    const auto names = get_const_names();
+    std::vector<std::shared_ptr<opset7::Constant>> consts(names.size());
+    std::vector<std::exception_ptr> errors(names.size());
+    // Each weight is stored in its own file, so the files are mapped and decoded in parallel.
+    // The constants refer to the mapped files instead of copying the weights.
+    ov::parallel_for(names.size(), [&](size_t i) {
+        try {
+            const auto& name = names[i];
+            const auto& tensor = m_var_places.at(name)->get_desc().type().lod_tensor().tensor();
+            Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
+            const auto& type = get_ov_type(tensor.data_type());
+            const auto& data_length = shape_size(shape) * type.size();
+
+            const auto const_path = get_const_path(folder_with_weights, name);
+            FRONT_END_GENERAL_CHECK(ov::util::file_exists(const_path), "Cannot open file for constant value.");
+            auto weights = ov::load_mmap_object(const_path);
 
+            // [ 16 byte ] -- header(not need)
+            // [ 4 byte ]  -- dims size
+            // [ x byte ]  -- dims(not need, the shape is taken from the model)
+            // [ y byte ]  -- weight
+            const size_t header_size = 16;
             uint32_t dims_len = 0;
-            is.read(reinterpret_cast<char*>(&dims_len), 4);
-            std::vector<char> dims_struct(dims_len);
-            is.read(&dims_struct[0], dims_len);
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else {
-            FRONT_END_GENERAL_CHECK(false, "Folder with weights must be provided.");
+            bool read_succeed = weights->size() >= header_size + sizeof(dims_len);
+            if (read_succeed) {
+                std::memcpy(&dims_len, weights->data() + header_size, sizeof(dims_len));
+                const size_t offset = header_size + sizeof(dims_len) + dims_len;
+                read_succeed = weights->size() >= offset && weights->size() - offset >= data_length;
+                if (read_succeed)
+                    consts[i] = create_shared_constant(type, shape, weights, offset, data_length);
+            }
+            FRONT_END_GENERAL_CHECK(read_succeed,
+                                    "File containing constant with name ",
+                                    name,
+                                    " wasn't successfully read.");
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+
+    for (size_t i = 0; i < names.size(); i++) {
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+        consts[i]->set_friendly_name(names[i]);
+        m_tensor_values[names[i]] = consts[i];
+    }
+}
+
+// load_consts with mapped weights is compatible with new PaddlePaddle API.
+void InputModel::InputModelImpl::load_consts(const std::shared_ptr<ov::MappedMemory>& weights) {
+    // The weights are stored one after another in the same layout as in load_consts(std::istream*).
+    // The position of each weight depends on the size of the previous one, so the headers are decoded
+    // sequentially, but nothing is copied: the constants refer to the mapped file.
+    size_t offset = 0;
+    for (const auto& name : get_const_names()) {
+        FRONT_END_GENERAL_CHECK(weights != nullptr && offset < weights->size(),
+                                "PaddlePaddle *.pdiparams format weight file doesn't exist!");
+        const size_t header_size = 16;
+        int32_t size = 0;
+        bool read_succeed = weights->size() - offset >= header_size + sizeof(size);
+        if (read_succeed) {
+            std::memcpy(&size, weights->data() + offset + header_size, sizeof(size));
+            offset += header_size + sizeof(size);
+            read_succeed = size >= 0 && weights->size() - offset >= static_cast<size_t>(size);
         }
         FRONT_END_GENERAL_CHECK(read_succeed,
                                 "File containing constant with name ",
                                 name,
                                 " wasn't successfully read.");
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
+
+        ::paddle::framework::proto::VarType_TensorDesc tensor_desc;
+        FRONT_END_GENERAL_CHECK(tensor_desc.ParseFromArray(weights->data() + offset, size),
+                                "Cannot parse tensor description of constant with name ",
+                                name,
+                                ".");
+        offset += size;
+        Shape shape(tensor_desc.dims().cbegin(), tensor_desc.dims().cend());
+        const auto& type = get_ov_type(tensor_desc.data_type());
+        const auto& data_length = shape_size(shape) * type.size();
+        FRONT_END_GENERAL_CHECK(weights->size() - offset >= data_length,
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+
+        auto const_node = create_shared_constant(type, shape, weights, offset, data_length);
+        offset += data_length;
         const_node->set_friendly_name(name);
         m_tensor_values[name] = const_node;
     }
@@ -314,17 +401,7 @@ void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_
 
 // load_consts with stream is compatible with new PaddlePaddle API.
 void InputModel::InputModelImpl::load_consts(std::istream* weight_stream) {
-    for (const auto& item : m_var_places) {
-        const auto& var_desc = item.second->get_desc();
-        const auto& name = item.first;
-        if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
-            continue;
-
-        // var_desc.persistable() is used to mark node const value or not.
-        if (!var_desc.persistable())
-            continue;
-
-        FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
+    for (const auto& name : get_const_names()) {
         FRONT_END_GENERAL_CHECK(weight_stream != nullptr && weight_stream->peek() != EOF,
                                 "PaddlePaddle *.pdiparams format weight file doesn't exist!");
         /*
@@ -385,8 +462,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
     : m_fw_ptr{std::make_shared<ProgramDesc>()},
       m_input_model(input_model),
       m_telemetry(telemetry) {
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream).c_str(), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_path;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_path).c_str(), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -400,7 +477,13 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     load_places();
     if (is_pdmodel(path)) {
-        load_consts(&weights_stream);
+        // Don't throw error if the weights file doesn't exist
+        // It may mean that model don't have constants
+        // An empty file is treated the same way, there is nothing to map
+        std::shared_ptr<ov::MappedMemory> weights;
+        if (ov::util::file_exists(weights_path) && ov::util::file_size(weights_path) > 0)
+            weights = ov::load_mmap_object(weights_path);
+        load_consts(weights);
     } else {
         load_consts(path);
     }
@@ -0,0 +1,254 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <openvino/frontend/exception.hpp>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/op/constant.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "paddle_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::frontend;
+
+namespace {
+using Constants = std::vector<std::shared_ptr<op::v0::Constant>>;
+
+std::string get_model_path(const std::string& name) {
+    return FrontEndTestUtils::make_model_path(std::string(TEST_PADDLE_MODELS_DIRNAME) + name + "/" + name +
+                                              ".pdmodel");
+}
+
+std::string get_weights_path(const std::string& model_path) {
+    return model_path.substr(0, model_path.size() - std::string(".pdmodel").size()) + ".pdiparams";
+}
+
+std::vector<char> read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void write_file(const std::string& path, const std::vector<char>& content) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(content.data(), content.size());
+}
+
+// copies the model next to the given weights, returns the path of the copy
+std::string copy_model(const std::string& model_path, const std::string& suffix, const std::vector<char>& weights) {
+    const auto path = ov::test::utils::generateTestFilePrefix() + suffix + ".pdmodel";
+    write_file(path, read_file(model_path));
+    write_file(get_weights_path(path), weights);
+    return path;
+}
+
+void remove_model(const std::string& path) {
+    std::remove(get_weights_path(path).c_str());
+    std::remove(path.c_str());
+}
+
+std::shared_ptr<Model> decode_model(const std::string& path) {
+    FrontEndManager fem;
+    auto frontend = fem.load_by_framework(PADDLE_FE);
+    auto input_model = frontend->load(path);
+    // the frontend and the input model are released, the model keeps the mapped file on its own
+    return frontend->decode(input_model);
+}
+
+Constants get_constants(const std::shared_ptr<Model>& model) {
+    Constants constants;
+    for (const auto& op : model->get_ordered_ops()) {
+        auto constant = as_type_ptr<op::v0::Constant>(op);
+        if (constant && constant->get_byte_size() > 0)
+            constants.push_back(constant);
+    }
+    return constants;
+}
+
+// the constants share the mapped file if their data is laid out in the memory as in the file
+bool are_laid_out_as_in_file(const Constants& constants, const std::vector<char>& content) {
+    auto contains = [&](uintptr_t begin, const std::shared_ptr<op::v0::Constant>& constant) {
+        const auto ptr = reinterpret_cast<uintptr_t>(constant->get_data_ptr());
+        const auto size = constant->get_byte_size();
+        return ptr >= begin && size <= content.size() && ptr - begin <= content.size() - size &&
+               std::memcmp(content.data() + (ptr - begin), constant->get_data_ptr(), size) == 0;
+    };
+    // each occurrence of the largest constant in the file gives a candidate start of the mapping
+    const auto anchor = *std::max_element(constants.begin(),
+                                          constants.end(),
+                                          [](const std::shared_ptr<op::v0::Constant>& lhs,
+                                             const std::shared_ptr<op::v0::Constant>& rhs) {
+                                              return lhs->get_byte_size() < rhs->get_byte_size();
+                                          });
+    const auto anchor_data = static_cast<const char*>(anchor->get_data_ptr());
+    const auto anchor_end = anchor_data + anchor->get_byte_size();
+    for (auto it = std::search(content.begin(), content.end(), anchor_data, anchor_end); it != content.end();
+         it = std::search(it + 1, content.end(), anchor_data, anchor_end)) {
+        const auto begin = reinterpret_cast<uintptr_t>(anchor_data) - static_cast<uintptr_t>(it - content.begin());
+        if (std::all_of(constants.begin(), constants.end(), [&](const std::shared_ptr<op::v0::Constant>& constant) {
+                return contains(begin, constant);
+            }))
+            return true;
+    }
+    return false;
+}
+
+uint64_t read_varint(const std::vector<char>& content, size_t& pos) {
+    uint64_t value = 0;
+    for (size_t shift = 0; pos < content.size(); shift += 7) {
+        const auto byte = static_cast<uint8_t>(content[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            break;
+    }
+    return value;
+}
+
+// returns the byte size of the tensor data from the serialized VarType.TensorDesc
+size_t get_data_size(const std::vector<char>& content, size_t pos, size_t end) {
+    // the sizes of VarType.Type: BOOL, INT16, INT32, INT64, FP16, FP32, FP64 and UINT8, INT8, BF16
+    static const std::map<uint64_t, size_t> type_sizes =
+        {{0, 1}, {1, 2}, {2, 4}, {3, 8}, {4, 2}, {5, 4}, {6, 8}, {20, 1}, {21, 1}, {22, 2}};
+    size_t type_size = 0;
+    size_t elements = 1;
+    while (pos < end) {
+        const auto tag = read_varint(content, pos);
+        if (tag == (1 << 3)) {  // data_type
+            type_size = type_sizes.at(read_varint(content, pos));
+        } else if (tag == (2 << 3)) {  // dims
+            elements *= static_cast<size_t>(read_varint(content, pos));
+        } else if (tag == ((2 << 3) | 2)) {  // packed dims
+            const auto dims_end = pos + read_varint(content, pos);
+            while (pos < dims_end)
+                elements *= static_cast<size_t>(read_varint(content, pos));
+        } else {
+            throw std::runtime_error("Unexpected field of the tensor description");
+        }
+    }
+    return type_size * elements;
+}
+
+// pads the tensor descriptions with an unknown field, so the data of the weights starts the given number of bytes
+// past the 16 bytes boundary
+std::vector<char> pad_weights(const std::vector<char>& content, size_t shift) {
+    // [ 16 byte ] -- header, [ 4 byte ] -- TensorDesc size, [ x byte ] -- TensorDesc, [ y byte ] -- weight
+    const size_t header_size = 16;
+    std::vector<char> result;
+    size_t pos = 0;
+    while (pos < content.size()) {
+        int32_t desc_size = 0;
+        std::memcpy(&desc_size, content.data() + pos + header_size, sizeof(desc_size));
+        const auto desc = pos + header_size + sizeof(desc_size);
+        const auto data = desc + desc_size;
+        const auto data_size = get_data_size(content, desc, data);
+
+        // the unknown field is the tag, the length and the zero bytes, so it takes from 2 to 17 bytes
+        const auto data_offset = result.size() + header_size + sizeof(desc_size) + desc_size;
+        auto padding = (16 + shift - data_offset % 16) % 16;
+        if (padding < 2)
+            padding += 16;
+        const int32_t padded_size = desc_size + static_cast<int32_t>(padding);
+
+        result.insert(result.end(), content.begin() + pos, content.begin() + pos + header_size);
+        result.insert(result.end(),
+                      reinterpret_cast<const char*>(&padded_size),
+                      reinterpret_cast<const char*>(&padded_size) + sizeof(padded_size));
+        result.insert(result.end(), content.begin() + desc, content.begin() + data);
+        result.push_back(static_cast<char>((15 << 3) | 2));
+        result.push_back(static_cast<char>(padding - 2));
+        result.insert(result.end(), padding - 2, 0);
+        result.insert(result.end(), content.begin() + data, content.begin() + data + data_size);
+        pos = data + data_size;
+    }
+    return result;
+}
+}  // namespace
+
+TEST(PaddleMmapTest, model_from_file_outlives_frontend) {
+    const auto path = get_model_path("2in_2out");
+    const auto constants = get_constants(decode_model(path));
+    ASSERT_FALSE(constants.empty());
+    // the data of the constants is still readable when the frontend and the input model are gone
+    const auto content = read_file(get_weights_path(path));
+    for (const auto& constant : constants) {
+        const auto data = static_cast<const char*>(constant->get_data_ptr());
+        EXPECT_NE(std::search(content.begin(), content.end(), data, data + constant->get_byte_size()), content.end())
+            << constant->get_friendly_name();
+    }
+}
+
+TEST(PaddleMmapTest, constants_share_mapped_file) {
+    // the tensor descriptions are of variable size, so the weights are aligned explicitly to be shared
+    const auto weights = pad_weights(read_file(get_weights_path(get_model_path("2in_2out"))), 0);
+    const auto path = copy_model(get_model_path("2in_2out"), "_aligned", weights);
+    {
+        const auto constants = get_constants(decode_model(path));
+        // the kernels of both convolutions
+        ASSERT_GE(constants.size(), 2);
+        EXPECT_TRUE(are_laid_out_as_in_file(constants, weights));
+    }
+    remove_model(path);
+}
+
+TEST(PaddleMmapTest, misaligned_constants_are_copied) {
+    const auto path = get_model_path("2in_2out");
+    const auto misaligned_path = copy_model(path, "_misaligned", pad_weights(read_file(get_weights_path(path)), 1));
+    {
+        std::map<std::string, std::shared_ptr<op::v0::Constant>> expected;
+        for (const auto& constant : get_constants(decode_model(path)))
+            expected[constant->get_friendly_name()] = constant;
+
+        const auto constants = get_constants(decode_model(misaligned_path));
+        ASSERT_EQ(constants.size(), expected.size());
+        for (const auto& constant : constants) {
+            const auto& name = constant->get_friendly_name();
+            ASSERT_EQ(expected.count(name), 1) << name;
+            const auto alignment = constant->get_element_type().size();
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % alignment, 0) << name;
+            ASSERT_EQ(constant->get_byte_size(), expected[name]->get_byte_size()) << name;
+            EXPECT_EQ(std::memcmp(constant->get_data_ptr(), expected[name]->get_data_ptr(), constant->get_byte_size()),
+                      0)
+                << name;
+        }
+
+        FrontEndManager fem;
+        auto frontend = fem.load_by_framework(PADDLE_FE);
+        std::shared_ptr<Model> model;
+        ASSERT_NO_THROW(model = frontend->convert(frontend->load(misaligned_path)));
+        ASSERT_NE(model, nullptr);
+    }
+    remove_model(misaligned_path);
+}
+
+TEST(PaddleMmapTest, empty_weights_file_without_constants) {
+    // the model has no constants, so the empty weights file is not read, as if it was missing
+    const auto path = copy_model(get_model_path("relu"), "_empty_weights", {});
+    {
+        FrontEndManager fem;
+        auto frontend = fem.load_by_framework(PADDLE_FE);
+        std::shared_ptr<Model> model;
+        ASSERT_NO_THROW(model = frontend->convert(frontend->load(path)));
+        ASSERT_NE(model, nullptr);
+    }
+    remove_model(path);
+}
+
+TEST(PaddleMmapTest, empty_weights_file_with_constants) {
+    // the constants are missing in the empty weights file, it is reported as for the missing file
+    const auto path = copy_model(get_model_path("2in_2out"), "_empty_weights", {});
+    {
+        FrontEndManager fem;
+        auto frontend = fem.load_by_framework(PADDLE_FE);
+        ASSERT_THROW(frontend->load(path), GeneralFailure);
+    }
+    remove_model(path);
+}
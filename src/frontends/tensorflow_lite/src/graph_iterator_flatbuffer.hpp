@@ -4,11 +4,10 @@
 
 #pragma once
 
-#include <fstream>
-
 #include "openvino/core/any.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -23,7 +22,7 @@ struct TensorInfo {
 
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
-    std::vector<uint8_t> m_data;
+    std::shared_ptr<ov::MappedMemory> m_mapped_memory;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -65,6 +64,11 @@ public:
     /// \brief Returns the number of sub-graphs that can be enumerated with get_subgraph
     size_t get_subgraph_size() const;
 
+    /// \brief Returns the memory the model file is mapped to, the constants may refer to it directly
+    std::shared_ptr<ov::MappedMemory> get_mapped_memory() const {
+        return m_mapped_memory;
+    }
+
     /// \brief Returns iterator for a subgraph created on demand
     /// If there is no query for specific sub-graph iterator shouldn't be created
     /// idx should be in range 0..get_subgraph_size()-1
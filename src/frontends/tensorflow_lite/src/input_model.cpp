@@ -4,11 +4,13 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <queue>
 
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/log.hpp"
 #include "tensor_lite_place.hpp"
 #include "utils.hpp"
@@ -110,9 +112,27 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    const auto& type = place->get_element_type();
+                    const auto shape = place->get_partial_shape().to_shape();
+                    std::shared_ptr<ov::op::v0::Constant> constant;
+                    auto mapped_memory = m_graph_iterator->get_mapped_memory();
+                    // the typed access to the shared data requires the alignment of the element type,
+                    // the flatbuffer does not guarantee it, so the misaligned data is copied
+                    const auto alignment = std::max(type.size(), size_t{1});
+                    const bool is_aligned = reinterpret_cast<uintptr_t>(data) % alignment == 0;
+                    if (mapped_memory && is_aligned) {
+                        // the constant shares the mapped model file, so the weights are not copied
+                        const auto byte_size = (shape_size(shape) * type.bitwidth() + 7) / 8;
+                        constant = std::make_shared<ov::op::v0::Constant>(
+                            type,
+                            shape,
+                            std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                                static_cast<char*>(const_cast<void*>(data)),
+                                byte_size,
+                                mapped_memory));
+                    } else {
+                        constant = ov::op::v0::Constant::create(type, shape, data);
+                    }
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/op/constant.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::frontend;
+
+namespace {
+using Constants = std::vector<std::shared_ptr<op::v0::Constant>>;
+
+std::string get_model_path() {
+    return FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) +
+                                              "2in_2out/2in_2out.tflite");
+}
+
+std::vector<char> read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void write_file(const std::string& path, const std::vector<char>& content) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(content.data(), content.size());
+}
+
+std::shared_ptr<Model> decode_model(const std::string& path) {
+    FrontEndManager fem;
+    auto frontend = fem.load_by_framework(TF_LITE_FE);
+    auto input_model = frontend->load(path);
+    // the frontend and the input model are released, the model keeps the mapped file on its own
+    return frontend->decode(input_model);
+}
+
+Constants get_constants(const std::shared_ptr<Model>& model) {
+    Constants constants;
+    for (const auto& op : model->get_ordered_ops()) {
+        auto constant = as_type_ptr<op::v0::Constant>(op);
+        if (constant && constant->get_byte_size() > 0)
+            constants.push_back(constant);
+    }
+    return constants;
+}
+
+// the constants share the mapped file if their data is laid out in the memory as in the file
+bool are_laid_out_as_in_file(const Constants& constants, const std::vector<char>& content) {
+    auto contains = [&](uintptr_t begin, const std::shared_ptr<op::v0::Constant>& constant) {
+        const auto ptr = reinterpret_cast<uintptr_t>(constant->get_data_ptr());
+        const auto size = constant->get_byte_size();
+        return ptr >= begin && size <= content.size() && ptr - begin <= content.size() - size &&
+               std::memcmp(content.data() + (ptr - begin), constant->get_data_ptr(), size) == 0;
+    };
+    // each occurrence of the largest constant in the file gives a candidate start of the mapping
+    const auto anchor = *std::max_element(constants.begin(),
+                                          constants.end(),
+                                          [](const std::shared_ptr<op::v0::Constant>& lhs,
+                                             const std::shared_ptr<op::v0::Constant>& rhs) {
+                                              return lhs->get_byte_size() < rhs->get_byte_size();
+                                          });
+    const auto anchor_data = static_cast<const char*>(anchor->get_data_ptr());
+    const auto anchor_end = anchor_data + anchor->get_byte_size();
+    for (auto it = std::search(content.begin(), content.end(), anchor_data, anchor_end); it != content.end();
+         it = std::search(it + 1, content.end(), anchor_data, anchor_end)) {
+        const auto begin = reinterpret_cast<uintptr_t>(anchor_data) - static_cast<uintptr_t>(it - content.begin());
+        if (std::all_of(constants.begin(), constants.end(), [&](const std::shared_ptr<op::v0::Constant>& constant) {
+                return contains(begin, constant);
+            }))
+            return true;
+    }
+    return false;
+}
+
+template <typename T>
+T read_scalar(const std::vector<char>& content, size_t pos) {
+    T value;
+    std::memcpy(&value, content.data() + pos, sizeof(T));
+    return value;
+}
+
+size_t follow_offset(const std::vector<char>& content, size_t pos) {
+    return pos + read_scalar<uint32_t>(content, pos);
+}
+
+// returns the position of the field of the flatbuffer table, 0 if the field is not set
+size_t get_field(const std::vector<char>& content, size_t table, size_t field_id) {
+    const auto vtable = table - read_scalar<int32_t>(content, table);
+    const auto entry = 4 + 2 * field_id;
+    if (entry >= read_scalar<uint16_t>(content, vtable))
+        return 0;
+    const auto offset = read_scalar<uint16_t>(content, vtable + entry);
+    return offset ? table + offset : 0;
+}
+
+// moves the data of the model buffers to the end of the file, so the data starts one byte past the 16 bytes boundary
+std::vector<char> misalign_buffers(std::vector<char> content) {
+    const auto model = follow_offset(content, 0);
+    const auto buffers = follow_offset(content, get_field(content, model, 4));  // Model.buffers
+    const auto num_buffers = read_scalar<uint32_t>(content, buffers);
+    for (uint32_t i = 0; i < num_buffers; ++i) {
+        const auto buffer = follow_offset(content, buffers + 4 + 4 * i);
+        const auto data_field = get_field(content, buffer, 0);  // Buffer.data
+        if (data_field == 0)
+            continue;
+        const auto data = follow_offset(content, data_field);
+        const auto size = read_scalar<uint32_t>(content, data);
+        if (size == 0)
+            continue;
+        // the vector is the length followed by the bytes
+        while ((content.size() + 4) % 16 != 1)
+            content.push_back(0);
+        const std::vector<char> vector(content.begin() + data, content.begin() + data + 4 + size);
+        const auto offset = static_cast<uint32_t>(content.size() - data_field);
+        content.insert(content.end(), vector.begin(), vector.end());
+        std::memcpy(content.data() + data_field, &offset, sizeof(offset));
+    }
+    return content;
+}
+}  // namespace
+
+TEST(TFLiteMmapTest, model_from_file_outlives_frontend) {
+    const auto path = get_model_path();
+    const auto constants = get_constants(decode_model(path));
+    ASSERT_FALSE(constants.empty());
+    // the data of the constants is still readable when the frontend and the input model are gone
+    const auto content = read_file(path);
+    for (const auto& constant : constants) {
+        const auto data = static_cast<const char*>(constant->get_data_ptr());
+        EXPECT_NE(std::search(content.begin(), content.end(), data, data + constant->get_byte_size()), content.end())
+            << constant->get_friendly_name();
+    }
+
+    FrontEndManager fem;
+    auto frontend = fem.load_by_framework(TF_LITE_FE);
+    std::shared_ptr<Model> model;
+    ASSERT_NO_THROW(model = frontend->convert(frontend->load(path)));
+    ASSERT_NE(model, nullptr);
+}
+
+TEST(TFLiteMmapTest, constants_share_mapped_file) {
+    const auto path = get_model_path();
+    const auto constants = get_constants(decode_model(path));
+    // the kernels, the added constant and the paddings
+    ASSERT_GE(constants.size(), 2);
+    EXPECT_TRUE(are_laid_out_as_in_file(constants, read_file(path)));
+}
+
+TEST(TFLiteMmapTest, misaligned_constants_are_copied) {
+    const auto path = get_model_path();
+    const auto misaligned_path = ov::test::utils::generateTestFilePrefix() + "_misaligned.tflite";
+    write_file(misaligned_path, misalign_buffers(read_file(path)));
+    {
+        std::map<std::string, std::shared_ptr<op::v0::Constant>> expected;
+        for (const auto& constant : get_constants(decode_model(path)))
+            expected[constant->get_friendly_name()] = constant;
+
+        const auto constants = get_constants(decode_model(misaligned_path));
+        ASSERT_EQ(constants.size(), expected.size());
+        for (const auto& constant : constants) {
+            const auto& name = constant->get_friendly_name();
+            ASSERT_EQ(expected.count(name), 1) << name;
+            const auto alignment = constant->get_element_type().size();
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % alignment, 0) << name;
+            ASSERT_EQ(constant->get_byte_size(), expected[name]->get_byte_size()) << name;
+            EXPECT_EQ(std::memcmp(constant->get_data_ptr(), expected[name]->get_data_ptr(), constant->get_byte_size()),
+                      0)
+                << name;
+        }
+
+        FrontEndManager fem;
+        auto frontend = fem.load_by_framework(TF_LITE_FE);
+        std::shared_ptr<Model> model;
+        ASSERT_NO_THROW(model = frontend->convert(frontend->load(misaligned_path)));
+        ASSERT_NE(model, nullptr);
+    }
+    std::remove(misaligned_path.c_str());
+}
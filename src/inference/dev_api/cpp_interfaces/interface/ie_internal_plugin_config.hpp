@@ -88,6 +88,20 @@ INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines how many records can be stored per CPU runtime parameter type in the runtime parameters cache
+ * shared by all the streams of a compiled model on the same socket. Zero value (default) keeps per stream caches
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_SHARED_RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief Directory where the CPU plugin stores the input shapes seen by dynamic-shape models, so the runtime
+ * parameters cache can be pre-warmed when the same model is compiled again. Empty value (default) disables it
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_DIR);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
@@ -28,5 +28,55 @@ static constexpr Property<bool> enable_startup_fallback{"ENABLE_STARTUP_FALLBACK
  * selected device
  */
 static constexpr Property<bool> enable_runtime_fallback{"ENABLE_RUNTIME_FALLBACK"};
+
+/**
+ * @brief Enum to define the policy of distributing the infer requests between the devices in the cumulative
+ * throughput mode
+ */
+enum class SchedulePolicy {
+    DEVICE_PRIORITY = 0,           //!<  Run the request on the first device with an idle infer request in the priority
+                                   //!<  order
+    EXPECTED_COMPLETION_TIME = 1,  //!<  Run the request on the device with the lowest expected completion time, which is
+                                   //!<  estimated from the measured execution time and the number of running requests
+    DEFAULT = DEVICE_PRIORITY,     //!<  Default schedule policy
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy) {
+    switch (policy) {
+    case SchedulePolicy::DEVICE_PRIORITY:
+        return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::EXPECTED_COMPLETION_TIME:
+        return os << "EXPECTED_COMPLETION_TIME";
+    default:
+        OPENVINO_THROW("Unsupported schedule policy");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "DEVICE_PRIORITY") {
+        policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "EXPECTED_COMPLETION_TIME") {
+        policy = SchedulePolicy::EXPECTED_COMPLETION_TIME;
+    } else {
+        OPENVINO_THROW("Unsupported schedule policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief auto/multi device setting that defines the policy of distributing the infer requests between the devices in
+ * the cumulative throughput mode
+ */
+static constexpr Property<SchedulePolicy> schedule_policy{"SCHEDULE_POLICY"};
+
+/**
+ * @brief Read-only property of the compiled model in the cumulative throughput mode to get the statistics of
+ * the requests scheduling per device: the smoothed execution time, the number of running requests, etc.
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> schedule_statistics{"SCHEDULE_STATISTICS"};
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -657,6 +657,22 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the target latency (in ms) for the auto-batching. When it is set, the timeout used
+ * to collect the inputs is adapted to the requests arrival rate and the batch execution time, ov::auto_batch_timeout
+ * is used as the upper bound. 0 (default) means the fixed ov::auto_batch_timeout is used.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_target{"AUTO_BATCH_LATENCY_TARGET"};
+
+/**
+ * @brief Read-write property to enable the partial batches for the auto-batching. When it is set, the models for the
+ * power-of-two batch sizes below the device batch size are compiled as well, and the inputs collected by the timeout
+ * are executed with them instead of one by one. false (default) means no additional models are compiled.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_partial_batches{"AUTO_BATCH_PARTIAL_BATCHES"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -17,6 +17,7 @@
 #include "file_utils.h"
 #include "itt.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -42,6 +43,33 @@ static int32_t as_int32_t(T v) {
 
 namespace {
 
+// Hashes the printed data without accumulating it into a string
+class OstreamHashWrapper final : public std::streambuf {
+    uint64_t m_res = 0;
+
+public:
+    uint64_t getResult() const {
+        return m_res;
+    }
+
+    void reset() {
+        m_res = 0;
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        m_res = ov::hash_combine(m_res, ov::runtime::compute_hash(s, static_cast<size_t>(n)));
+        return n;
+    }
+
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            const char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+};
+
 uint64_t calculate_td(const InferenceEngine::TensorDesc& td, uint64_t _seed) {
     uint64_t seed = _seed;
 
@@ -93,13 +121,15 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     }
 
     // 3. Add runtime information which may not be serialized
+    OstreamHashWrapper rtHash;
+    std::ostream rtStream(&rtHash);
     for (const auto& op : model->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
             seed = ov::hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = ov::hash_combine(seed, strm.str());
+            rtHash.reset();
+            rtMapData.second.print(rtStream);
+            seed = ov::hash_combine(seed, rtHash.getResult());
         }
     }
 
@@ -167,16 +197,7 @@ std::string ModelCache::compute_hash(const std::string& modelStr,
     // tensor data
     if (tensor) {
         seed = hash_combine(seed, tensor.get_size());
-
-        auto ptr = static_cast<size_t*>(tensor.data());
-        size_t size = tensor.get_size() / sizeof(size_t);
-        for (size_t i = 0; i < size; i++)
-            seed = hash_combine(seed, ptr[i]);
-        auto size_done = size * sizeof(size_t);
-        auto ptr_left = static_cast<uint8_t*>(tensor.data()) + size_done;
-        size_t size_left = tensor.get_size() - size_done;
-        for (size_t i = 0; i < size_left; i++)
-            seed = hash_combine(seed, ptr_left[i]);
+        seed = hash_combine(seed, ov::runtime::compute_hash(tensor.data(), tensor.get_size()));
     }
 
     // compile options
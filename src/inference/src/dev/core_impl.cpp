@@ -1546,14 +1546,29 @@ void ov::CoreImpl::AddExtensionUnsafe(const InferenceEngine::IExtensionPtr& exte
 }
 
 void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
-    auto it = config.find(CONFIG_KEY(CACHE_DIR));
+    auto it = config.find(ov::enable_mmap.name());
+    if (it != config.end()) {
+        auto flag = it->second.as<bool>();
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        if (_flag_enable_mmap != flag) {
+            _flag_enable_mmap = flag;
+            // cache managers read compiled blobs via mmap depending on the flag, so recreate them
+            _cacheConfig = CoreConfig::CacheConfig::create(_cacheConfig._cacheDir, _flag_enable_mmap);
+            for (auto& deviceCfg : _cacheConfigPerDevice) {
+                deviceCfg.second = CoreConfig::CacheConfig::create(deviceCfg.second._cacheDir, _flag_enable_mmap);
+            }
+        }
+        config.erase(it);
+    }
+
+    it = config.find(CONFIG_KEY(CACHE_DIR));
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _flag_enable_mmap);
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _flag_enable_mmap);
         }
         config.erase(it);
     }
@@ -1564,18 +1579,11 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         ov::threading::executor_manager()->set_property({{it->first, flag}});
         config.erase(it);
     }
-
-    it = config.find(ov::enable_mmap.name());
-    if (it != config.end()) {
-        auto flag = it->second.as<bool>();
-        _flag_enable_mmap = flag;
-        config.erase(it);
-    }
 }
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir, _flag_enable_mmap);
 }
 
 std::string ov::CoreImpl::CoreConfig::get_cache_dir() const {
@@ -1595,7 +1603,7 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         auto cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val, get_enable_mmap());
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1613,12 +1621,13 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     }
 }
 
-ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir,
+                                                                                     bool enable_mmap) {
     std::shared_ptr<ov::ICacheManager> cache_manager = nullptr;
 
     if (!dir.empty()) {
         FileUtils::createDirectoryRecursive(dir);
-        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir, enable_mmap);
     }
 
     return {dir, cache_manager};
@@ -75,7 +75,7 @@ private:
             std::string _cacheDir;
             std::shared_ptr<ov::ICacheManager> _cacheManager;
 
-            static CacheConfig create(const std::string& dir);
+            static CacheConfig create(const std::string& dir, bool enable_mmap);
         };
 
         /**
@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -23,7 +24,22 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// the executor owning the current worker thread and the index of the worker's task queue
+thread_local const void* t_worker_executor = nullptr;
+thread_local int t_worker_queue_id = -1;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    // Every worker thread owns a task queue. The owner takes tasks from the front, idle workers steal them from
+    // the back, so a single lock is not contended by all the streams
+    struct TaskQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+        // NUMA node of the owner's stream, -1 until the owner has created its stream
+        std::atomic<int> _numaNodeId{-1};
+    };
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -477,24 +493,30 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                t_worker_executor = this;
+                t_worker_queue_id = streamId;
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                    if (Pop(streamId, task)) {
+                        if (task) {
+                            auto& stream = *(_streams.local());
+                            _taskQueues[streamId]->_numaNodeId.store(stream._numaNodeId, std::memory_order_relaxed);
+                            Execute(task, stream);
                         }
+                        continue;
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
-                    }
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    ++_sleepingWorkers;
+                    _queueCondVar.wait(lock, [&] {
+                        return _pendingTasks > 0 || (stopped = _isStopped);
+                    });
+                    --_sleepingWorkers;
                 }
             });
         }
@@ -502,11 +524,58 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        // tasks created by a worker are kept in its own queue, external tasks are distributed in round-robin
+        const auto queueId = t_worker_executor == this
+                                 ? t_worker_queue_id
+                                 : static_cast<int>(_nextQueueId++ % static_cast<unsigned>(_taskQueues.size()));
         {
+            auto& queue = *_taskQueues[queueId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+        }
+        ++_pendingTasks;
+        // a worker increments _sleepingWorkers before checking _pendingTasks under _mutex,
+        // so either it sees the new task or it is notified here
+        if (_sleepingWorkers > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool Pop(int queueId, Task& task) {
+        bool found = false;
+        {
+            auto& queue = *_taskQueues[queueId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (!queue._tasks.empty()) {
+                task = std::move(queue._tasks.front());
+                queue._tasks.pop_front();
+                found = true;
+            }
+        }
+        // tasks are stolen from the streams of the same NUMA node first, the neighbour streams are visited earlier;
+        // the node of a stream is known after it has run its first task
+        const auto queues = static_cast<int>(_taskQueues.size());
+        const auto numaNodeId = _taskQueues[queueId]->_numaNodeId.load(std::memory_order_relaxed);
+        for (auto sameNode : {true, false}) {
+            for (auto i = 1; !found && i < queues; ++i) {
+                auto& queue = *_taskQueues[(queueId + i) % queues];
+                const auto victimNumaNodeId = queue._numaNodeId.load(std::memory_order_relaxed);
+                if ((numaNodeId >= 0 && victimNumaNodeId == numaNodeId) != sameNode) {
+                    continue;
+                }
+                std::lock_guard<std::mutex> lock(queue._mutex);
+                if (!queue._tasks.empty()) {
+                    task = std::move(queue._tasks.back());
+                    queue._tasks.pop_back();
+                    found = true;
+                }
+            }
+        }
+        if (found) {
+            --_pendingTasks;
         }
-        _queueCondVar.notify_one();
+        return found;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -545,7 +614,10 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<int> _pendingTasks{0};
+    std::atomic<int> _sleepingWorkers{0};
+    std::atomic<unsigned> _nextQueueId{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -12,10 +12,14 @@
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <random>
 #include <string>
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 
@@ -80,6 +84,7 @@ public:
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    bool m_mmapEnabled;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
@@ -89,8 +94,13 @@ public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Directory where the cache entries are stored
+     * @param mmapEnabled If true, cache entries are read through a memory mapping (ov::SharedStreamBuffer),
+     * so plugins aware of it may reference the blob content without copying it
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, bool mmapEnabled = false)
+        : m_cachePath(std::move(cachePath)),
+          m_mmapEnabled(mmapEnabled) {}
 
     /**
      * @brief Destructor
@@ -100,15 +110,39 @@ public:
 
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // the blob may be mapped by the models imported before (in this or another process), so it is not rewritten
+        // in place: the entry is written to a temporary file which then replaces the blob
+        const auto blobFileName = getBlobFile(id);
+        std::random_device random;
+        const auto tmpFileName = blobFileName + "." + std::to_string(random()) + std::to_string(random()) + ".tmp";
+        try {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+            stream.close();
+            if (!stream || !ov::util::replace_file(tmpFileName, blobFileName))
+                std::remove(tmpFileName.c_str());
+        } catch (...) {
+            std::remove(tmpFileName.c_str());
+            throw;
+        }
     }
 
     void read_cache_entry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            if (m_mmapEnabled) {
+                auto mapped_memory = ov::load_mmap_object(blobFileName);
+                auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                    mapped_memory->data(),
+                    mapped_memory->size(),
+                    mapped_memory);
+                ov::SharedStreamBuffer stream_buffer(buffer);
+                std::istream stream(&stream_buffer);
+                reader(stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
@@ -5,7 +5,10 @@
 #include <gtest/gtest.h>
 #include <ie_system_conf.h>
 
+#include <algorithm>
+#include <chrono>
 #include <future>
+#include <iostream>
 #include <ie_parallel.hpp>
 #include <thread>
 #include <threading/ie_cpu_streams_executor.hpp>
@@ -163,6 +166,60 @@ TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
 }
 
+TEST_P(TaskExecutorTests, canRunTasksFromTasks) {
+    constexpr int NUM_SUBTASKS = 1000;
+    std::atomic_int sharedVar = {0};
+    std::promise<void> allDone;
+    // executor is destroyed first, so no task can access the variables above after they are released
+    auto taskExecutor = GetParam()();
+    auto f = async(taskExecutor, [&] {
+        for (int i = 0; i < NUM_SUBTASKS; i++) {
+            taskExecutor->run([&] {
+                if (++sharedVar == NUM_SUBTASKS) {
+                    allDone.set_value();
+                }
+            });
+        }
+    });
+    ASSERT_NO_THROW(f.get());
+    allDone.get_future().wait();
+    ASSERT_EQ(NUM_SUBTASKS, sharedVar);
+}
+
+// Measures the executor throughput when many threads submit small tasks simultaneously
+TEST(CPUStreamsExecutorTests, DISABLED_tasksPerSecondUnderContention) {
+    constexpr int NUM_TASKS_PER_PRODUCER = 100000;
+    const int numProducers = std::max(2, parallel_get_max_threads());
+    for (auto streams : {1, 4, 16, 64}) {
+        std::atomic_int sharedVar = {0};
+        auto start = std::chrono::steady_clock::now();
+        {
+            auto taskExecutor = std::make_shared<CPUStreamsExecutor>(
+                IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                         streams,
+                                         1,
+                                         IStreamsExecutor::ThreadBindingType::NONE});
+            std::vector<std::thread> producers;
+            for (int i = 0; i < numProducers; i++) {
+                producers.emplace_back([&] {
+                    for (int k = 0; k < NUM_TASKS_PER_PRODUCER; k++) {
+                        taskExecutor->run([&] {
+                            ++sharedVar;
+                        });
+                    }
+                });
+            }
+            for (auto&& producer : producers)
+                producer.join();
+            // executor waits for all the tasks in destructor
+        }
+        const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(numProducers * NUM_TASKS_PER_PRODUCER, sharedVar);
+        std::cout << streams << " streams, " << numProducers
+                  << " producers: " << static_cast<int64_t>(sharedVar / duration) << " tasks/s" << std::endl;
+    }
+}
+
 class ASyncTaskExecutorTests : public TaskExecutorTests {};
 
 // TODO: Issue-11695
@@ -69,6 +69,7 @@ struct WorkerInferRequest {
     std::exception_ptr            m_exception_ptr = nullptr;
     std::list<Time>               m_start_times;
     std::list<Time>               m_end_times;
+    Time                          m_start_time;
     int                           m_index = 0;
     AutoImmediateExecutor::Ptr    m_fallback_exec;
 };
@@ -213,6 +214,7 @@ public:
     bool                                           m_startup_fallback = true;
     bool                                           m_runtime_fallback = true;
     bool                                           m_bind_buffer = false;
+    ov::intel_auto::SchedulePolicy                 m_schedule_policy = ov::intel_auto::SchedulePolicy::DEFAULT;
     std::shared_ptr<ov::Model>                     m_model;
     std::string                                    m_model_path;
     std::shared_ptr<const ov::IPlugin>             m_plugin;
@@ -4,12 +4,21 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "cumulative_schedule.hpp"
+
+#include <algorithm>
+#include <limits>
+
 #include "async_infer_request.hpp"
 #include "plugin.hpp"
 
 // ------------------------------CumuSchedule----------------------------
 namespace ov {
 namespace auto_plugin {
+namespace {
+// weight of the last measured execution time in the smoothed one
+constexpr double exec_time_smoothing = 0.2;
+}  // namespace
+
 bool CumuSchedule::select_other_device(const std::string& cur_dev_name) {
     {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -217,13 +226,24 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         devices = m_context->m_device_priorities;
     }
     lock.unlock();
-    for (auto&& device : devices) {
-        if (!preferred_device.empty() && (device.device_name != preferred_device)) {
-            continue;
-        }
-        if (run_pipeline_task(pipeline_task, m_idle_worker_requests[device.device_name], preferred_device)) {
+    const bool by_completion_time =
+        preferred_device.empty() && m_context->m_schedule_policy == ov::intel_auto::SchedulePolicy::EXPECTED_COMPLETION_TIME;
+    if (by_completion_time) {
+        const auto expected_times = sort_by_expected_completion_time(devices);
+        if (dispatch_by_expected_completion_time(expected_times, [&](size_t i) {
+                return run_on_device(pipeline_task, devices[i].device_name, preferred_device);
+            })) {
             return true;
         }
+    } else {
+        for (auto&& device : devices) {
+            if (!preferred_device.empty() && (device.device_name != preferred_device)) {
+                continue;
+            }
+            if (run_on_device(pipeline_task, device.device_name, preferred_device)) {
+                return true;
+            }
+        }
     }
     // no vacant requests this time, storing the task to the respective queue
     if (!preferred_device.empty()) {
@@ -234,6 +254,133 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
     return false;
 }
 
+bool CumuSchedule::run_on_device(ov::threading::Task& pipeline_task,
+                                 const std::string& device,
+                                 const DeviceName& preferred_device) {
+    {
+        std::lock_guard<std::mutex> lock(m_statistics_mutex);
+        auto it = m_statistics.find(device);
+        if (it == m_statistics.end()) {
+            // no workers were generated for the device
+            return false;
+        }
+        // counted before the start, as the request may be done before run_pipeline_task returns
+        ++it->second.in_flight;
+    }
+    const bool started = run_pipeline_task(pipeline_task, m_idle_worker_requests[device], preferred_device);
+    std::lock_guard<std::mutex> lock(m_statistics_mutex);
+    auto& statistics = m_statistics[device];
+    if (started) {
+        ++statistics.dispatched;
+    } else {
+        --statistics.in_flight;
+    }
+    return started;
+}
+
+void CumuSchedule::generate_workers(const std::string& device, const SoCompiledModel& compiled_model) {
+    Schedule::generate_workers(device, compiled_model);
+    const auto workers = m_worker_requests[device].size();
+    std::lock_guard<std::mutex> lock(m_statistics_mutex);
+    m_statistics[device].workers = workers;
+}
+
+void CumuSchedule::on_worker_infer_done(const std::string& device, const WorkerInferRequest& worker_request) {
+    const auto exec_time =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - worker_request.m_start_time).count();
+    std::lock_guard<std::mutex> lock(m_statistics_mutex);
+    auto& statistics = m_statistics[device];
+    if (statistics.in_flight > 0) {
+        --statistics.in_flight;
+    }
+    if (worker_request.m_exception_ptr) {
+        ++statistics.failed;
+        return;
+    }
+    ++statistics.completed;
+    statistics.exec_time_ms = statistics.completed == 1
+                                  ? exec_time
+                                  : statistics.exec_time_ms + exec_time_smoothing * (exec_time - statistics.exec_time_ms);
+}
+
+double CumuSchedule::expected_completion_time(const DeviceStatistics& statistics) {
+    if (statistics.workers == 0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (statistics.completed == 0) {
+        // nothing is known about the device yet, explore it while it has an idle worker
+        return statistics.in_flight < statistics.workers ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+    // the new request waits for the running ones if all the workers are busy
+    const auto waiting = statistics.in_flight + 1 > statistics.workers ? statistics.in_flight + 1 - statistics.workers : 0;
+    return statistics.exec_time_ms * (1.0 + static_cast<double>(waiting) / statistics.workers);
+}
+
+std::vector<double> CumuSchedule::rank_devices(const std::map<std::string, DeviceStatistics>& statistics,
+                                               std::vector<DeviceInformation>& devices) {
+    std::vector<std::pair<double, DeviceInformation>> ranked_devices;
+    ranked_devices.reserve(devices.size());
+    for (auto&& device : devices) {
+        auto it = statistics.find(device.device_name);
+        const auto time =
+            it == statistics.end() ? std::numeric_limits<double>::infinity() : expected_completion_time(it->second);
+        ranked_devices.emplace_back(time, std::move(device));
+    }
+    std::stable_sort(ranked_devices.begin(),
+                     ranked_devices.end(),
+                     [](const std::pair<double, DeviceInformation>& a, const std::pair<double, DeviceInformation>& b) {
+                         return a.first < b.first;
+                     });
+    std::vector<double> times;
+    times.reserve(ranked_devices.size());
+    devices.clear();
+    for (auto&& ranked_device : ranked_devices) {
+        times.push_back(ranked_device.first);
+        devices.push_back(std::move(ranked_device.second));
+    }
+    return times;
+}
+
+bool CumuSchedule::dispatch_by_expected_completion_time(const std::vector<double>& expected_times,
+                                                        const std::function<bool(size_t)>& try_run) {
+    // expected completion time on the best busy device, waiting for it is better than running on the slower devices
+    double busy_device_time = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < expected_times.size(); i++) {
+        if (expected_times[i] > busy_device_time) {
+            return false;
+        }
+        if (try_run(i)) {
+            return true;
+        }
+        // an unmeasured device (0) that lost its idle worker gives no estimate to wait for
+        if (expected_times[i] > 0.0 && expected_times[i] < busy_device_time) {
+            busy_device_time = expected_times[i];
+        }
+    }
+    return false;
+}
+
+std::vector<double> CumuSchedule::sort_by_expected_completion_time(std::vector<DeviceInformation>& devices) const {
+    std::lock_guard<std::mutex> lock(m_statistics_mutex);
+    return rank_devices(m_statistics, devices);
+}
+
+ov::AnyMap CumuSchedule::get_schedule_statistics() const {
+    ov::AnyMap all_statistics;
+    std::lock_guard<std::mutex> lock(m_statistics_mutex);
+    for (const auto& item : m_statistics) {
+        const auto& statistics = item.second;
+        all_statistics[item.first] = ov::AnyMap{{"EXEC_TIME_MS", statistics.exec_time_ms},
+                                                {"EXPECTED_COMPLETION_TIME_MS", expected_completion_time(statistics)},
+                                                {"WORKERS", statistics.workers},
+                                                {"IN_FLIGHT", statistics.in_flight},
+                                                {"DISPATCHED", statistics.dispatched},
+                                                {"COMPLETED", statistics.completed},
+                                                {"FAILED", statistics.failed}};
+    }
+    return all_statistics;
+}
+
 CumuSchedule::~CumuSchedule() {
     if (m_context) {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -5,6 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <functional>
+#include <map>
+
 #include "schedule.hpp"
 #include "async_infer_request.hpp"
 
@@ -17,6 +20,29 @@ public:
     virtual ~CumuSchedule();
     std::unique_ptr<AutoCompileContext[]>      m_p_ctput_loadcontext = nullptr;
     size_t                                  m_n_ctput_devicenums = 0;
+    // returns the scheduling counters per device, see ov::intel_auto::schedule_statistics
+    ov::AnyMap get_schedule_statistics() const;
+
+    struct DeviceStatistics {
+        // smoothed time from the dispatching of the request to its completion, 0 until the first request is done
+        double exec_time_ms = 0.0;
+        size_t workers = 0;
+        size_t in_flight = 0;
+        size_t dispatched = 0;
+        size_t completed = 0;
+        size_t failed = 0;
+    };
+    // expected time to complete a new request on the device; an unmeasured device is preferred (0) while it has
+    // an idle worker and is not ranked (infinity) while all its workers are busy
+    static double expected_completion_time(const DeviceStatistics& statistics);
+    // sorts the devices by the expected completion time of a new request (stable, so the priority breaks the ties)
+    // and returns the sorted times
+    static std::vector<double> rank_devices(const std::map<std::string, DeviceStatistics>& statistics,
+                                            std::vector<DeviceInformation>& devices);
+    // tries the ranked devices in order until try_run starts the request on one of them; stops and returns false,
+    // so the request is queued, when a busy device tried before is expected to complete it earlier
+    static bool dispatch_by_expected_completion_time(const std::vector<double>& expected_times,
+                                                     const std::function<bool(size_t)>& try_run);
 
 private:
     void init() override;
@@ -24,6 +50,13 @@ private:
     bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") override;
     void try_to_compile_model(AutoCompileContext& context, const std::shared_ptr<ov::Model>& model) override;
     bool select_other_device(const std::string& cur_dev_name) override;
+    void generate_workers(const std::string& device, const SoCompiledModel& compiled_model) override;
+    void on_worker_infer_done(const std::string& device, const WorkerInferRequest& worker_request) override;
+    bool run_on_device(ov::threading::Task& pipeline_task, const std::string& device, const DeviceName& preferred_device);
+    std::vector<double> sort_by_expected_completion_time(std::vector<DeviceInformation>& devices) const;
+
+    mutable std::mutex                      m_statistics_mutex;
+    std::map<std::string, DeviceStatistics> m_statistics;
 };
 } // namespace auto_plugin
 } // namespace ov
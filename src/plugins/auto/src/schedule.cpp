@@ -60,6 +60,7 @@ bool Schedule::run_pipeline_task(ov::threading::Task& pipeline_task,
         worker_request_ptr = worker.second;
         IdleGuard<NotBusyPriorityWorkerRequests> idle_guard{worker_request_ptr, idle_workerrequests};
         m_this_worker_infer_request = worker_request_ptr;
+        worker_request_ptr->m_start_time = std::chrono::steady_clock::now();
         {
             auto captured_task = std::move(pipeline_task);
             captured_task();
@@ -103,6 +104,7 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
             [worker_request_ptr, this, device, idle_workerrequests_ptr](std::exception_ptr exception_ptr) mutable {
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{worker_request_ptr, *idle_workerrequests_ptr};
                 worker_request_ptr->m_exception_ptr = std::move(exception_ptr);
+                on_worker_infer_done(device, *worker_request_ptr);
                 {
                     auto stop_retry_and_continue = [worker_request_ptr]() {
                         auto captured_task = std::move(worker_request_ptr->m_task);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "cumulative_schedule.hpp"
 #include "include/auto_unit_test.hpp"
 
 using namespace ov::mock_auto_plugin;
@@ -209,3 +210,136 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoCTPUTCallMulti,
                          AutoCTPUTCallMulti,
                          ::testing::ValuesIn(testConfigs_1),
                          AutoCTPUTCallMulti::getTestCaseName);
+
+class AutoCTPUTSchedulePolicy : public tests::AutoTest, public ::testing::Test {
+public:
+    void SetUp() override {
+        std::vector<std::string> availableDevs = {"CPU", "GPU"};
+        ON_CALL(*core, get_available_devices()).WillByDefault(Return(availableDevs));
+        ON_CALL(*core,
+                compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                              ::testing::Matcher<const std::string&>(StrEq(ov::test::utils::DEVICE_CPU)),
+                              _))
+            .WillByDefault(Return(mockExeNetwork));
+        ON_CALL(*core,
+                compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                              ::testing::Matcher<const std::string&>(StrEq(ov::test::utils::DEVICE_GPU)),
+                              _))
+            .WillByDefault(Return(mockExeNetworkActual));
+    }
+};
+
+TEST_F(AutoCTPUTSchedulePolicy, ScheduleStatisticsPerDevice) {
+    plugin->set_device_name("AUTO");
+    config.insert(ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT));
+    config.insert(ov::device::priorities("GPU,CPU"));
+    config.insert(ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::EXPECTED_COMPLETION_TIME));
+    std::shared_ptr<ov::ICompiledModel> exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = plugin->compile_model(model, config));
+    EXPECT_EQ(exeNetwork->get_property(ov::intel_auto::schedule_policy.name()).as<ov::intel_auto::SchedulePolicy>(),
+              ov::intel_auto::SchedulePolicy::EXPECTED_COMPLETION_TIME);
+
+    auto statistics = exeNetwork->get_property(ov::intel_auto::schedule_statistics.name()).as<ov::AnyMap>();
+    ASSERT_EQ(statistics.size(), 2);
+    for (const auto& device : {ov::test::utils::DEVICE_CPU, ov::test::utils::DEVICE_GPU}) {
+        ASSERT_NE(statistics.find(device), statistics.end());
+        auto device_statistics = statistics.at(device).as<ov::AnyMap>();
+        EXPECT_EQ(device_statistics.at("WORKERS").as<size_t>(), optimalNum.as<uint32_t>());
+        EXPECT_EQ(device_statistics.at("IN_FLIGHT").as<size_t>(), 0);
+        EXPECT_EQ(device_statistics.at("DISPATCHED").as<size_t>(), 0);
+        // no request is measured yet
+        EXPECT_EQ(device_statistics.at("EXPECTED_COMPLETION_TIME_MS").as<double>(), 0.0);
+    }
+}
+
+TEST_F(AutoCTPUTSchedulePolicy, UnsupportedSchedulePolicyThrows) {
+    EXPECT_THROW(plugin->set_property({{ov::intel_auto::schedule_policy.name(), "ROUND_ROBIN"}}), ov::Exception);
+}
+
+namespace {
+ov::auto_plugin::CumuSchedule::DeviceStatistics make_statistics(double exec_time_ms,
+                                                                size_t workers,
+                                                                size_t in_flight,
+                                                                size_t completed) {
+    ov::auto_plugin::CumuSchedule::DeviceStatistics statistics;
+    statistics.exec_time_ms = exec_time_ms;
+    statistics.workers = workers;
+    statistics.in_flight = in_flight;
+    statistics.completed = completed;
+    return statistics;
+}
+}  // namespace
+
+TEST(AutoCTPUTExpectedCompletionTime, UnmeasuredDeviceIsPreferredOnlyWhenIdle) {
+    using ov::auto_plugin::CumuSchedule;
+    const auto infinity = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(CumuSchedule::expected_completion_time(make_statistics(0.0, 2, 1, 0)), 0.0);
+    EXPECT_EQ(CumuSchedule::expected_completion_time(make_statistics(0.0, 2, 2, 0)), infinity);
+    EXPECT_EQ(CumuSchedule::expected_completion_time(make_statistics(10.0, 0, 0, 0)), infinity);
+    EXPECT_EQ(CumuSchedule::expected_completion_time(make_statistics(10.0, 2, 1, 5)), 10.0);
+    // two requests wait for the two busy workers
+    EXPECT_EQ(CumuSchedule::expected_completion_time(make_statistics(10.0, 2, 3, 5)), 20.0);
+}
+
+TEST(AutoCTPUTExpectedCompletionTime, RankDevices) {
+    using ov::auto_plugin::CumuSchedule;
+    using ov::auto_plugin::DeviceInformation;
+    std::map<std::string, CumuSchedule::DeviceStatistics> statistics = {
+        {"GPU.0", make_statistics(4.0, 1, 1, 3)},   // busy, 8 ms
+        {"GPU.1", make_statistics(0.0, 1, 1, 0)},   // busy and unmeasured
+        {"CPU", make_statistics(10.0, 2, 0, 3)},    // idle, 10 ms
+        {"NPU", make_statistics(0.0, 1, 0, 0)}};    // idle and unmeasured
+    std::vector<DeviceInformation> devices = {{"GPU.0"}, {"GPU.1"}, {"CPU"}, {"NPU"}, {"FPGA"}};
+    const auto times = CumuSchedule::rank_devices(statistics, devices);
+
+    std::vector<std::string> names;
+    for (const auto& device : devices)
+        names.push_back(device.device_name);
+    EXPECT_EQ(names, (std::vector<std::string>{"NPU", "GPU.0", "CPU", "GPU.1", "FPGA"}));
+    EXPECT_EQ(times[0], 0.0);
+    EXPECT_EQ(times[1], 8.0);
+    EXPECT_EQ(times[2], 10.0);
+}
+
+TEST(AutoCTPUTExpectedCompletionTime, BusyUnmeasuredDeviceDoesNotStallDispatch) {
+    using ov::auto_plugin::CumuSchedule;
+    using ov::auto_plugin::DeviceInformation;
+    // the unmeasured GPU holds its only worker, the measured CPU is idle
+    std::map<std::string, CumuSchedule::DeviceStatistics> statistics = {{"GPU", make_statistics(0.0, 1, 1, 0)},
+                                                                        {"CPU", make_statistics(10.0, 1, 0, 3)}};
+    std::vector<DeviceInformation> devices = {{"GPU"}, {"CPU"}};
+    const auto times = CumuSchedule::rank_devices(statistics, devices);
+    std::vector<std::string> tried;
+    EXPECT_TRUE(CumuSchedule::dispatch_by_expected_completion_time(times, [&](size_t i) {
+        tried.push_back(devices[i].device_name);
+        return devices[i].device_name == "CPU";
+    }));
+    EXPECT_EQ(tried, (std::vector<std::string>{"CPU"}));
+}
+
+TEST(AutoCTPUTExpectedCompletionTime, QueueForFasterBusyDevice) {
+    using ov::auto_plugin::CumuSchedule;
+    // the first device is busy and expected to complete earlier than the idle ones
+    std::vector<size_t> tried;
+    EXPECT_FALSE(CumuSchedule::dispatch_by_expected_completion_time({4.0, 10.0, 20.0}, [&](size_t i) {
+        tried.push_back(i);
+        return i != 0;
+    }));
+    EXPECT_EQ(tried, (std::vector<size_t>{0}));
+
+    // an unmeasured device that lost its idle worker does not make the request wait
+    tried.clear();
+    EXPECT_TRUE(CumuSchedule::dispatch_by_expected_completion_time({0.0, 10.0}, [&](size_t i) {
+        tried.push_back(i);
+        return i == 1;
+    }));
+    EXPECT_EQ(tried, (std::vector<size_t>{0, 1}));
+
+    // the idle device that is expected to complete earlier is used
+    tried.clear();
+    EXPECT_TRUE(CumuSchedule::dispatch_by_expected_completion_time({4.0, 10.0}, [&](size_t i) {
+        tried.push_back(i);
+        return true;
+    }));
+    EXPECT_EQ(tried, (std::vector<size_t>{0}));
+}
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "adaptive_timeout.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ov {
+namespace autobatch_plugin {
+
+namespace {
+// weight of the new sample in the moving averages
+constexpr double smoothing_factor = 0.1;
+// for normally distributed values the mean absolute deviation is ~0.8 sigma, so mean + 3 deviations is ~p99
+constexpr double high_percentile_deviations = 3.0;
+// extra time to wait for the batch to absorb the jitter of the arrivals
+constexpr double arrival_jitter_headroom = 1.25;
+}  // namespace
+
+void AdaptiveTimeout::Estimate::update(double value) {
+    if (!valid) {
+        mean = value;
+        deviation = 0;
+        valid = true;
+        return;
+    }
+    deviation += smoothing_factor * (std::abs(value - mean) - deviation);
+    mean += smoothing_factor * (value - mean);
+}
+
+double AdaptiveTimeout::Estimate::high_percentile() const {
+    return mean + high_percentile_deviations * deviation;
+}
+
+AdaptiveTimeout::AdaptiveTimeout(size_t batch_size)
+    : m_batch_size(batch_size),
+      m_execution_time_us(batch_size + 1) {}
+
+void AdaptiveTimeout::set_latency_target(uint32_t latency_target_ms) {
+    m_latency_target_ms = latency_target_ms;
+}
+
+bool AdaptiveTimeout::is_enabled() const {
+    return m_latency_target_ms != 0;
+}
+
+void AdaptiveTimeout::on_request_arrival(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_has_arrival) {
+        // pauses in the traffic longer than the latency target say nothing about the batching opportunities
+        const double target_us = 1000.0 * m_latency_target_ms;
+        const double interval_us = std::chrono::duration<double, std::micro>(now - m_last_arrival).count();
+        m_arrival_interval_us.update(std::min(std::max(interval_us, 0.0), target_us));
+    }
+    m_last_arrival = now;
+    m_has_arrival = true;
+}
+
+void AdaptiveTimeout::on_requests_executed(size_t num_requests, Clock::duration execution_time) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (num_requests == 0 || num_requests >= m_execution_time_us.size())
+        return;
+    m_execution_time_us[num_requests].update(std::chrono::duration<double, std::micro>(execution_time).count());
+}
+
+std::chrono::microseconds AdaptiveTimeout::get_timeout(uint32_t max_timeout_ms) const {
+    const double max_timeout_us = 1000.0 * max_timeout_ms;
+    const double target_us = 1000.0 * m_latency_target_ms;
+    double timeout_us = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // the collected requests are executed either as a full batch or on the timeout,
+        // so the slowest way of the execution must fit into the latency target together with the waiting
+        double execution_us = 0;
+        for (const auto& time : m_execution_time_us) {
+            if (time.valid)
+                execution_us = std::max(execution_us, time.high_percentile());
+        }
+        timeout_us = target_us - execution_us;
+        if (m_arrival_interval_us.valid && m_batch_size > 1) {
+            // no reason to wait longer than the full batch is expected to be collected
+            const double fill_time_us =
+                m_arrival_interval_us.mean * static_cast<double>(m_batch_size - 1) * arrival_jitter_headroom;
+            timeout_us = std::min(timeout_us, fill_time_us);
+        }
+    }
+    timeout_us = std::min(std::max(timeout_us, 0.0), max_timeout_us);
+    return std::chrono::microseconds(static_cast<int64_t>(timeout_us));
+}
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+// Chooses the time to wait for the batch to be collected, so the first request of the batch meets the latency target.
+// Tracks the requests arrival rate and the high percentile of the execution time of the collected requests.
+class AdaptiveTimeout {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit AdaptiveTimeout(size_t batch_size);
+
+    // 0 disables the adaptive timeout
+    void set_latency_target(uint32_t latency_target_ms);
+
+    bool is_enabled() const;
+
+    void on_request_arrival(Clock::time_point now = Clock::now());
+
+    // execution time of the num_requests requests executed together (either as a batch or in the fallback mode)
+    void on_requests_executed(size_t num_requests, Clock::duration execution_time);
+
+    // time to wait for the rest of the batch since the first request of the batch arrived
+    std::chrono::microseconds get_timeout(uint32_t max_timeout_ms) const;
+
+private:
+    // exponential moving average of the value and its absolute deviation
+    struct Estimate {
+        void update(double value);
+        double high_percentile() const;
+
+        double mean = 0;
+        double deviation = 0;
+        bool valid = false;
+    };
+
+    mutable std::mutex m_mutex;
+    std::atomic<uint32_t> m_latency_target_ms = {0};
+    const size_t m_batch_size;
+    Clock::time_point m_last_arrival;
+    bool m_has_arrival = false;
+    Estimate m_arrival_interval_us;
+    std::vector<Estimate> m_execution_time_us;  // indexed by the number of requests executed together
+};
+}  // namespace autobatch_plugin
+}  // namespace ov
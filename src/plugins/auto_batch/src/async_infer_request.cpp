@@ -65,11 +65,18 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                const bool adaptive_timeout = workerInferRequest->_adaptive_timeout->is_enabled();
+                if (adaptive_timeout)
+                    workerInferRequest->_adaptive_timeout->on_request_arrival();
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_cond.notify_one();
+                } else if (adaptive_timeout && sz == 1) {
+                    // the first request of the batch starts the adaptive timeout, the worker must not miss it
+                    std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
+                    workerInferRequest->_cond.notify_one();
                 }
             };
             AsyncInferRequest* _this = nullptr;
@@ -81,7 +88,8 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                  auto batchReq = this->m_sync_request->m_batched_request_wrapper;
                  if (batchReq->_exception_ptr)  // when the batchN execution failed
                      std::rethrow_exception(batchReq->_exception_ptr);
-                 // in the case of non-batched execution the tensors were set explicitly
+                 // in the case of non-batched execution the tensors were set explicitly,
+                 // the partial batch outputs are copied by the worker on the completion
                  if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                      this->m_sync_request->m_batched_request_status) {
                      this->m_sync_request->copy_outputs_if_needed();
@@ -111,6 +119,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->get_profiling_info();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->get_profiling_info();
     else
         return m_request_without_batch->get_profiling_info();
 }
@@ -119,6 +129,8 @@ std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() cons
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->query_state();
     else
         return m_request_without_batch->query_state();
 }
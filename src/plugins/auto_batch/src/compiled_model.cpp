@@ -17,18 +17,38 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::string>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_partial_batch(compiled_models_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_target = config.find(ov::auto_batch_latency_target.name());
+    if (latency_target != config.end())
+        m_latency_target = latency_target->second.as<std::uint32_t>();
+    for (const auto& partial_batch : m_compiled_models_partial_batch)
+        m_partial_batch_sizes.insert(partial_batch.first);
+}
+
+std::vector<uint32_t> CompiledModel::split_into_partial_batches(uint32_t num_requests,
+                                                                const std::set<uint32_t>& partial_batch_sizes) {
+    std::vector<uint32_t> batches;
+    for (auto it = partial_batch_sizes.rbegin(); it != partial_batch_sizes.rend(); ++it) {
+        if (*it > 1 && *it <= num_requests) {
+            batches.push_back(*it);
+            num_requests -= *it;
+        }
+    }
+    batches.resize(batches.size() + num_requests, 1);
+    return batches;
 }
 
 CompiledModel::~CompiledModel() {
@@ -64,10 +84,15 @@ CompiledModel::GetWorkerInferRequest() const {
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
+        workerRequestPtr->_adaptive_timeout.reset(new AdaptiveTimeout(workerRequestPtr->_batch_size));
+        workerRequestPtr->_adaptive_timeout->set_latency_target(m_latency_target);
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                workerRequestPtr->_adaptive_timeout->on_requests_executed(
+                    workerRequestPtr->_batch_size,
+                    AdaptiveTimeout::Clock::now() - workerRequestPtr->_batch_start_time);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -82,7 +107,15 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    // in the adaptive mode the first request of the batch wakes the worker up,
+                    // so the timeout is counted from the arrival of the first request
+                    if (workerRequestPtr->_adaptive_timeout->is_enabled() && workerRequestPtr->_tasks.size()) {
+                        status = workerRequestPtr->_cond.wait_for(
+                            lock,
+                            workerRequestPtr->_adaptive_timeout->get_timeout(m_time_out));
+                    } else {
+                        status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    }
                 }
                 if (m_terminate) {
                     break;
@@ -99,31 +132,92 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_batch_start_time = AdaptiveTimeout::Clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        // timeout to collect the batch is over, the collected requests are executed with
+                        // the largest fitting partial batches, the rest of them are executed in the batch1 mode
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(
+                            sz);
+                        for (int n = 0; n < sz; n++) {
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
+                        }
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->m_sync_request->m_exception_ptr = p;
-                                    t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
+                        auto on_completed = [sz, &arrived, &all_completed](int num) {
+                            if (sz == (arrived += num)) {
+                                all_completed.set_value();
+                            }
+                        };
+                        const auto start_time = AdaptiveTimeout::Clock::now();
+                        const auto partial_batches =
+                            split_into_partial_batches(static_cast<uint32_t>(sz), m_partial_batch_sizes);
+                        int n = 0;
+                        for (const auto partial_batch : partial_batches) {
+                            if (partial_batch == 1)
+                                break;
+                            const int partial_batch_size = static_cast<int>(partial_batch);
+                            const auto& partial_model = m_compiled_models_partial_batch.at(partial_batch);
+                            auto& partial_request = workerRequestPtr->_infer_requests_partial_batch[partial_batch];
+                            if (!partial_request) {
+                                partial_request._ptr = partial_model->create_infer_request();
+                                if (partial_request._so == nullptr)
+                                    partial_request._so = partial_model._so;
+                            }
+                            std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
+                                partial_tasks(tasks.begin() + n, tasks.begin() + n + partial_batch_size);
+                            for (int b = 0; b < partial_batch_size; b++) {
+                                auto sync_request = partial_tasks[b].first->m_sync_request;
+                                sync_request->copy_inputs_to_partial_batch(partial_request, b, partial_batch_size);
+                                sync_request->m_partial_batch_request = partial_request;
+                                sync_request->m_batched_request_status =
+                                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                            }
+                            // the request is owned by the worker (which outlives the request's callback)
+                            auto partial_request_ptr = &partial_request;
+                            partial_request->set_callback(
+                                [partial_tasks, partial_request_ptr, &on_completed](std::exception_ptr p) mutable {
+                                    const int partial_batch_size = static_cast<int>(partial_tasks.size());
+                                    for (int b = 0; b < partial_batch_size; b++) {
+                                        auto sync_request = partial_tasks[b].first->m_sync_request;
+                                        if (p) {
+                                            sync_request->m_exception_ptr = p;
+                                        } else {
+                                            try {
+                                                sync_request->copy_outputs_from_partial_batch(*partial_request_ptr,
+                                                                                              b,
+                                                                                              partial_batch_size);
+                                            } catch (...) {
+                                                sync_request->m_exception_ptr = std::current_exception();
+                                            }
+                                        }
+                                        // the callback stays with the request, so it must not keep the tasks
+                                        auto task = std::move(partial_tasks[b].second);
+                                        task();
                                     }
+                                    on_completed(partial_batch_size);
                                 });
+                            partial_request->start_async();
+                            n += partial_batch_size;
+                        }
+                        for (; n < sz; n++) {
+                            const auto& t = tasks[n];
+                            t.first->m_request_without_batch->set_callback([t, &on_completed](std::exception_ptr p) {
+                                if (p)
+                                    t.first->m_sync_request->m_exception_ptr = p;
+                                t.second();
+                                on_completed(1);
+                            });
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
                             t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
                             t.first->m_request_without_batch->start_async();
                         }
                         all_completed_future.get();
+                        workerRequestPtr->_adaptive_timeout->on_requests_executed(
+                            sz,
+                            AdaptiveTimeout::Clock::now() - start_time);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -163,11 +257,20 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_latency_target.name()) {
+            m_latency_target = property.second.as<std::uint32_t>();
+            m_config[ov::auto_batch_latency_target.name()] = property.second.as<std::uint32_t>();
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            for (const auto& worker : m_worker_requests) {
+                worker->_adaptive_timeout->set_latency_target(m_latency_target);
+            }
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch_latency_target.name());
         }
     }
 }
@@ -203,7 +306,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                                             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
                                             ov::execution_devices.name()};
         } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-            return std::vector<std::string>{ov::auto_batch_timeout.name()};
+            return std::vector<std::string>{ov::auto_batch_timeout.name(), ov::auto_batch_latency_target.name()};
         } else if (name == ov::execution_devices) {
             return m_compiled_model_without_batch->get_property(name);
         } else if (name == ov::loaded_from_cache) {
@@ -215,10 +318,17 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{METRIC_KEY(SUPPORTED_CONFIG_KEYS), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_latency_target.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_partial_batches.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_target) {
+            uint32_t latency_target = m_latency_target;
+            return latency_target;
+        } else if (name == ov::auto_batch_partial_batches) {
+            return !m_compiled_models_partial_batch.empty();
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -6,8 +6,11 @@
 #pragma once
 
 #include <condition_variable>
+#include <map>
+#include <set>
 #include <thread>
 
+#include "adaptive_timeout.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -22,6 +25,8 @@ class CompiledModel : public ov::ICompiledModel {
 public:
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
+        // requests for the partial batches, created on the first use by the worker thread (indexed by the batch size)
+        std::map<uint32_t, ov::SoPtr<ov::IAsyncInferRequest>> _infer_requests_partial_batch;
         int _batch_size;
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
@@ -30,6 +35,8 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
+        std::unique_ptr<AdaptiveTimeout> _adaptive_timeout;
+        AdaptiveTimeout::Clock::time_point _batch_start_time;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -40,7 +47,8 @@ public:
                   const std::set<std::string>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -58,6 +66,11 @@ public:
 
     const std::vector<ov::Output<const ov::Node>>& inputs() const override;
 
+    // splits the requests collected by the timeout into the largest fitting partial batches (each size is used once,
+    // as the worker has a single request per size), the rest of the requests are listed as the batch1 executions
+    static std::vector<uint32_t> split_into_partial_batches(uint32_t num_requests,
+                                                            const std::set<uint32_t>& partial_batch_sizes);
+
 protected:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     static unsigned int ParseTimeoutValue(const std::string&);
@@ -71,13 +84,17 @@ protected:
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
-    std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_time_out = {0};        // in ms
+    std::atomic<std::uint32_t> m_latency_target = {0};  // in ms, 0 if the adaptive timeout is disabled
 
     const std::set<std::string> m_batched_inputs;
     const std::set<std::string> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    // models compiled for the batch sizes smaller than the device_batch_size, indexed by the batch size
+    const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_partial_batch;
+    std::set<uint32_t> m_partial_batch_sizes;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -26,7 +26,9 @@ OPENVINO_SUPPRESS_DEPRECATED_START
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  ov::device::priorities.name(),
                                                  ov::auto_batch_timeout.name(),
-                                                 ov::cache_dir.name()};
+                                                 ov::cache_dir.name(),
+                                                 ov::auto_batch_latency_target.name(),
+                                                 ov::auto_batch_partial_batches.name()};
 OPENVINO_SUPPRESS_DEPRECATED_END
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -132,7 +134,9 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 
 Plugin::Plugin() {
     set_device_name("BATCH");
-    m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_timeout(1000));          // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_latency_target(0));      // adaptive timeout is disabled by default
+    m_plugin_config.insert(ov::auto_batch_partial_batches(false));  // partial batches are not compiled by default
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -282,51 +286,66 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
-    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
-    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
-        try {
-            auto inputs = reshaped->inputs();
-            std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
-            for (auto& input : inputs) {
-                auto input_shape = input.get_shape();
-                if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input, ov::PartialShape(input_shape)});
+    auto compile_with_batch = [&](uint32_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<ov::Output<ov::Node>, ov::PartialShape> partial_shapes;
+        for (auto& input : inputs) {
+            auto input_shape = input.get_shape();
+            if (batched_inputs.find(ov::op::util::get_ie_output_name(input)) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
             }
+            partial_shapes.insert({input, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
 
-            reshaped->reshape(partial_shapes);
-
-            OPENVINO_SUPPRESS_DEPRECATED_START
-            for (auto&& input : reshaped->inputs()) {
-                auto& rt_info = input.get_rt_info();
-                auto it = rt_info.find("ie_legacy_td");
-                if (it != rt_info.end()) {
-                    auto td = it->second.as<InferenceEngine::TensorDesc>();
-                    rt_info["ie_legacy_td"] =
-                        InferenceEngine::TensorDesc(td.getPrecision(), input.get_shape(), td.getLayout());
-                }
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        for (auto&& input : reshaped->inputs()) {
+            auto& rt_info = input.get_rt_info();
+            auto it = rt_info.find("ie_legacy_td");
+            if (it != rt_info.end()) {
+                auto td = it->second.as<InferenceEngine::TensorDesc>();
+                rt_info["ie_legacy_td"] =
+                    InferenceEngine::TensorDesc(td.getPrecision(), input.get_shape(), td.getLayout());
             }
-            for (auto&& result : reshaped->get_results()) {
-                auto output = result->input_value(0);
-                auto& rt_info = output.get_rt_info();
-                auto it = rt_info.find("ie_legacy_td");
-                if (it != rt_info.end()) {
-                    auto td = it->second.as<InferenceEngine::TensorDesc>();
-                    rt_info["ie_legacy_td"] =
-                        InferenceEngine::TensorDesc(td.getPrecision(), output.get_shape(), td.getLayout());
-                }
+        }
+        for (auto&& result : reshaped->get_results()) {
+            auto output = result->input_value(0);
+            auto& rt_info = output.get_rt_info();
+            auto it = rt_info.find("ie_legacy_td");
+            if (it != rt_info.end()) {
+                auto td = it->second.as<InferenceEngine::TensorDesc>();
+                rt_info["ie_legacy_td"] =
+                    InferenceEngine::TensorDesc(td.getPrecision(), output.get_shape(), td.getLayout());
             }
-            OPENVINO_SUPPRESS_DEPRECATED_END
+        }
+        OPENVINO_SUPPRESS_DEPRECATED_END
 
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
+
+    ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> compiled_models_partial_batch;
+    if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
+        try {
+            compiled_model_with_batch = compile_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
+    if (compiled_model_with_batch && full_properties.at(ov::auto_batch_partial_batches.name()).as<bool>()) {
+        // the ladder of the smaller batches executes the requests collected by the timeout
+        // (instead of executing them one by one with the batch1), at the cost of the extra compilations
+        for (uint32_t batch_size = 2; batch_size < meta_device.device_batch_size; batch_size *= 2) {
+            try {
+                compiled_models_partial_batch[batch_size] = compile_with_batch(batch_size);
+            } catch (const ov::Exception&) {
+                // not critical, the requests that do not fit the available partial batches are executed with batch1
+            }
+        }
+    }
 
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
@@ -351,7 +370,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_partial_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "adaptive_timeout.hpp"
+
+using namespace ov::autobatch_plugin;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+class AdaptiveTimeoutTest : public ::testing::Test {
+public:
+    static constexpr size_t batch_size = 8;
+    AdaptiveTimeout m_timeout{batch_size};
+
+    void arrive_with_interval(milliseconds interval, size_t num) {
+        auto now = AdaptiveTimeout::Clock::now();
+        for (size_t i = 0; i < num; i++) {
+            m_timeout.on_request_arrival(now);
+            now += interval;
+        }
+    }
+};
+
+TEST_F(AdaptiveTimeoutTest, DisabledByDefault) {
+    EXPECT_FALSE(m_timeout.is_enabled());
+    m_timeout.set_latency_target(100);
+    EXPECT_TRUE(m_timeout.is_enabled());
+    m_timeout.set_latency_target(0);
+    EXPECT_FALSE(m_timeout.is_enabled());
+}
+
+TEST_F(AdaptiveTimeoutTest, LatencyTargetWithoutStatistics) {
+    m_timeout.set_latency_target(100);
+    EXPECT_EQ(m_timeout.get_timeout(1000), milliseconds(100));
+    // never waits longer than the fixed timeout
+    EXPECT_EQ(m_timeout.get_timeout(50), milliseconds(50));
+}
+
+TEST_F(AdaptiveTimeoutTest, WaitsForExpectedBatchFill) {
+    m_timeout.set_latency_target(100);
+    arrive_with_interval(milliseconds(2), 20);
+    // 7 more requests are expected in 14 ms, plus the headroom for the jitter
+    EXPECT_EQ(m_timeout.get_timeout(1000), microseconds(17500));
+}
+
+TEST_F(AdaptiveTimeoutTest, ExecutionTimeReducesTimeout) {
+    m_timeout.set_latency_target(100);
+    m_timeout.on_requests_executed(batch_size, milliseconds(80));
+    EXPECT_EQ(m_timeout.get_timeout(1000), milliseconds(20));
+    // slow fallback execution is taken into account as well
+    m_timeout.on_requests_executed(3, milliseconds(90));
+    EXPECT_EQ(m_timeout.get_timeout(1000), milliseconds(10));
+}
+
+TEST_F(AdaptiveTimeoutTest, ExecutionTimeJitterReducesTimeout) {
+    m_timeout.set_latency_target(100);
+    m_timeout.on_requests_executed(batch_size, milliseconds(50));
+    const auto stable_timeout = m_timeout.get_timeout(1000);
+    m_timeout.on_requests_executed(batch_size, milliseconds(70));
+    m_timeout.on_requests_executed(batch_size, milliseconds(30));
+    EXPECT_LT(m_timeout.get_timeout(1000), stable_timeout);
+}
+
+TEST_F(AdaptiveTimeoutTest, NoWaitingWhenTargetCannotBeMet) {
+    m_timeout.set_latency_target(10);
+    m_timeout.on_requests_executed(batch_size, milliseconds(20));
+    EXPECT_EQ(m_timeout.get_timeout(1000), microseconds(0));
+}
+
+TEST_F(AdaptiveTimeoutTest, PausesInTrafficAreIgnored) {
+    m_timeout.set_latency_target(100);
+    arrive_with_interval(milliseconds(1000), 2);
+    EXPECT_EQ(m_timeout.get_timeout(1000), milliseconds(100));
+}
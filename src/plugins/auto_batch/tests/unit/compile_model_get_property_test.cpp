@@ -157,6 +157,8 @@ const std::vector<get_property_param> compile_model_get_property_param_test = {
     get_property_param{ov::execution_devices.name(), false},
     get_property_param{CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), false},
     get_property_param{ov::auto_batch_timeout.name(), false},
+    get_property_param{ov::auto_batch_latency_target.name(), false},
+    get_property_param{ov::auto_batch_partial_batches.name(), false},
     get_property_param{ov::cache_dir.name(), false},
     // Config in dependent m_plugin
     get_property_param{"OPTIMAL_BATCH_SIZE", false},
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "compiled_model.hpp"
+
+using ov::autobatch_plugin::CompiledModel;
+
+using Batches = std::vector<uint32_t>;
+
+TEST(AutoBatchPartialBatchTest, SplitIntoLargestFittingBatches) {
+    // the ladder for the device batch size of 8
+    const std::set<uint32_t> ladder = {2, 4};
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(7, ladder), (Batches{4, 2, 1}));
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(6, ladder), (Batches{4, 2}));
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(5, ladder), (Batches{4, 1}));
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(3, ladder), (Batches{2, 1}));
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(1, ladder), (Batches{1}));
+}
+
+TEST(AutoBatchPartialBatchTest, EachBatchIsUsedOnce) {
+    // a failed compilation leaves a gap in the ladder, the rest of the requests are executed with batch1
+    const std::set<uint32_t> ladder = {4};
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(7, ladder), (Batches{4, 1, 1, 1}));
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(3, ladder), (Batches{1, 1, 1}));
+}
+
+TEST(AutoBatchPartialBatchTest, WithoutPartialBatches) {
+    // the partial batches are not enabled, so all the requests are executed with batch1
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(3, {}), (Batches{1, 1, 1}));
+    EXPECT_EQ(CompiledModel::split_into_partial_batches(0, {}), (Batches{}));
+}
@@ -123,6 +123,7 @@ TEST_P(CompileModelSetPropertyTest, CompileModelSetPropertyTestCase) {
 
 const std::vector<set_property_param> compile_model_set_property_param_test = {
     set_property_param{{{CONFIG_KEY(AUTO_BATCH_TIMEOUT), std::uint32_t(100)}}, false},
+    set_property_param{{{ov::auto_batch_latency_target.name(), std::uint32_t(20)}}, false},
     set_property_param{{{"INCORRECT_CONFIG", 2}}, true},
 };
 
@@ -74,6 +74,7 @@ TEST_P(SetPropertyTest, SetPropertyTestCase) {
 const std::vector<set_property_params> plugin_set_property_params_test = {
     set_property_params{{{"AUTO_BATCH_TIMEOUT", "200"}}, false},
     set_property_params{{{"AUTO_BATCH_DEVICE_CONFIG", "CPU(4)"}}, false},
+    set_property_params{{{"AUTO_BATCH_PARTIAL_BATCHES", "YES"}}, false},
     set_property_params{{{"CACHE_DIR", "./xyz"}}, false},
     set_property_params{{{"AUTO_BATCH_TIMEOUT", "200"}, {"AUTO_BATCH_DEVICE_CONFIG", "CPU(4)"}}, false},
     set_property_params{{{"AUTO_BATCH_TIMEOUT", "200"}, {"AUTO_BATCH_DEVICE_CONFIG", "CPU(4)"}, {"CACHE_DIR", "./xyz"}},
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
 #include <thread>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -223,6 +225,95 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_outputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyPartialBatchTensorTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    ov::SoPtr<ov::IAsyncInferRequest> partial_batch_request = {m_async_infer_request_with_batch, {}};
+    EXPECT_NO_THROW(req->copy_inputs_to_partial_batch(partial_batch_request, 0, 1));
+    EXPECT_NO_THROW(req->copy_outputs_from_partial_batch(partial_batch_request, 0, 1));
+}
+
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyPartialBatchOffsetsTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    // the request is executed as the 3rd one of the partial batch of 4
+    const size_t partial_batch_size = 4;
+    const size_t batch_id = 2;
+    auto partial_model = m_model->clone();
+    partial_model->reshape(ov::PartialShape{static_cast<int64_t>(partial_batch_size), 3, 24, 24});
+    auto i_compile_model_partial_batch =
+        std::make_shared<NiceMock<MockICompiledModel>>(partial_model, m_auto_batch_plugin);
+    auto sync_infer_request_partial_batch =
+        std::make_shared<NiceMock<MockISyncInferRequest>>(i_compile_model_partial_batch);
+    ov::SoPtr<ov::IAsyncInferRequest> partial_batch_request = {
+        std::make_shared<NiceMock<MockIAsyncInferRequest>>(sync_infer_request_partial_batch, m_executor, nullptr),
+        {}};
+
+    for (const auto& input : req->get_inputs()) {
+        auto tensor = req->get_tensor(input);
+        auto data = static_cast<uint8_t*>(tensor->data());
+        for (size_t i = 0; i < tensor->get_byte_size(); i++)
+            data[i] = static_cast<uint8_t>(i % 251 + 1);
+        auto partial_tensor = partial_batch_request->get_tensor(input);
+        std::memset(partial_tensor->data(), 0, partial_tensor->get_byte_size());
+    }
+    req->copy_inputs_to_partial_batch(partial_batch_request, batch_id, partial_batch_size);
+    for (const auto& input : req->get_inputs()) {
+        auto tensor = req->get_tensor(input);
+        auto partial_tensor = partial_batch_request->get_tensor(input);
+        const auto size = tensor->get_byte_size();
+        ASSERT_EQ(partial_tensor->get_byte_size(), size * partial_batch_size);
+        auto partial_data = static_cast<uint8_t*>(partial_tensor->data());
+        for (size_t b = 0; b < partial_batch_size; b++) {
+            if (b == batch_id) {
+                EXPECT_EQ(std::memcmp(partial_data + b * size, tensor->data(), size), 0);
+            } else {
+                EXPECT_TRUE(std::all_of(partial_data + b * size, partial_data + (b + 1) * size, [](uint8_t value) {
+                    return value == 0;
+                })) << "slot " << b << " is overwritten";
+            }
+        }
+    }
+
+    for (const auto& output : req->get_outputs()) {
+        auto partial_tensor = partial_batch_request->get_tensor(output);
+        const auto size = partial_tensor->get_byte_size() / partial_batch_size;
+        auto partial_data = static_cast<uint8_t*>(partial_tensor->data());
+        for (size_t b = 0; b < partial_batch_size; b++)
+            std::memset(partial_data + b * size, static_cast<int>(b + 1), size);
+        auto tensor = req->get_tensor(output);
+        std::memset(tensor->data(), 0, tensor->get_byte_size());
+    }
+    req->copy_outputs_from_partial_batch(partial_batch_request, batch_id, partial_batch_size);
+    for (const auto& output : req->get_outputs()) {
+        auto tensor = req->get_tensor(output);
+        auto data = static_cast<uint8_t*>(tensor->data());
+        EXPECT_TRUE(std::all_of(data, data + tensor->get_byte_size(), [batch_id](uint8_t value) {
+            return value == batch_id + 1;
+        }));
+    }
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
@@ -4,19 +4,34 @@
 
 #include "async_infer_request.hpp"
 
+// Starts the subrequest once its pipeline stage has a free slot and continues the pipeline when it is done
 struct RequestExecutor : ov::threading::ITaskExecutor {
-    explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
+    RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request,
+                    const std::shared_ptr<ov::hetero::PipelineStage>& stage)
+        : m_request(request),
+          m_stage(stage) {
         m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
-            m_exception_ptr = std::move(exception_ptr);
-            auto task = std::move(m_task);
-            task();
+            finish(std::move(exception_ptr));
         });
     }
     void run(ov::threading::Task task) override {
         m_task = std::move(task);
-        m_request->start_async();
+        m_stage->submit([this] {
+            try {
+                m_request->start_async();
+            } catch (...) {
+                finish(std::current_exception());
+            }
+        });
     };
+    void finish(std::exception_ptr exception_ptr) {
+        m_exception_ptr = std::move(exception_ptr);
+        m_stage->release();
+        auto task = std::move(m_task);
+        task();
+    }
     ov::SoPtr<ov::IAsyncInferRequest>& m_request;
+    std::shared_ptr<ov::hetero::PipelineStage> m_stage;
     std::exception_ptr m_exception_ptr;
     ov::threading::Task m_task;
 };
@@ -27,8 +42,9 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
+    for (size_t i = 0; i < m_infer_request->m_subrequests.size(); ++i) {
+        auto request_executor = std::make_shared<RequestExecutor>(m_infer_request->m_subrequests[i],
+                                                                  m_infer_request->m_pipeline_stages[i]);
         m_pipeline.emplace_back(request_executor, [request_executor] {
             if (nullptr != request_executor->m_exception_ptr) {
                 std::rethrow_exception(request_executor->m_exception_ptr);
@@ -132,6 +132,7 @@ void ov::hetero::CompiledModel::compile_model(const std::shared_ptr<ov::Model>&
         }
     }
     set_inputs_and_outputs();
+    create_pipeline_stages();
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -224,6 +225,14 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    create_pipeline_stages();
+}
+
+void ov::hetero::CompiledModel::create_pipeline_stages() {
+    m_pipeline_stages.clear();
+    for (const auto& comp_model_desc : m_compiled_submodels) {
+        m_pipeline_stages.emplace_back(std::make_shared<PipelineStage>(comp_model_desc.device, m_cfg.pipeline_depth));
+    }
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -275,7 +284,9 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
                                                     ov::loaded_from_cache,
-                                                    ov::hetero::number_of_submodels};
+                                                    ov::hetero::number_of_submodels,
+                                                    ov::hetero::pipeline_depth,
+                                                    ov::hetero::pipeline_statistics};
         return ro_properties;
     };
     const auto& to_string_vector = [](const std::vector<ov::PropertyName>& properties) {
@@ -336,6 +347,14 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         return decltype(ov::execution_devices)::value_type{device_names};
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{m_compiled_submodels.size()};
+    } else if (ov::hetero::pipeline_depth == name) {
+        return decltype(ov::hetero::pipeline_depth)::value_type{m_cfg.pipeline_depth};
+    } else if (ov::hetero::pipeline_statistics == name) {
+        ov::AnyMap statistics;
+        for (size_t i = 0; i < m_pipeline_stages.size(); ++i) {
+            statistics["subgraph" + std::to_string(i)] = m_pipeline_stages[i]->get_statistics();
+        }
+        return decltype(ov::hetero::pipeline_statistics)::value_type{statistics};
     }
     return m_cfg.get(name);
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -7,6 +7,7 @@
 #include "config.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "pipeline_stage.hpp"
 #include "subgraph_collector.hpp"
 
 namespace ov {
@@ -48,6 +49,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void create_pipeline_stages();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -61,6 +64,8 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // the execution stages of the submodels shared by all the infer requests
+    std::vector<std::shared_ptr<PipelineStage>> m_pipeline_stages;
 };
 }  // namespace hetero
 }  // namespace ov
\ No newline at end of file
@@ -35,6 +35,7 @@ struct Configuration {
 
     std::string device_priorities;
     ov::AnyMap device_properties;
+    uint32_t pipeline_depth;
 
 private:
     bool dump_graph;
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include <algorithm>
+#include <future>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+double to_ms(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
+ov::hetero::PipelineStage::PipelineStage(std::string device, size_t depth)
+    : m_device(std::move(device)),
+      m_depth(depth) {}
+
+void ov::hetero::PipelineStage::start(Clock::time_point now) {
+    if (m_first_start == Clock::time_point{})
+        m_first_start = now;
+    if (m_in_flight == 0)
+        m_busy_start = now;
+    ++m_in_flight;
+}
+
+void ov::hetero::PipelineStage::submit(ov::threading::Task task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto now = Clock::now();
+        if (m_depth != 0 && m_in_flight >= m_depth) {
+            m_queue.push_back({std::move(task), now});
+            m_max_queue_size = std::max(m_max_queue_size, m_queue.size());
+            return;
+        }
+        start(now);
+    }
+    task();
+}
+
+void ov::hetero::PipelineStage::acquire() {
+    std::promise<void> ready;
+    auto future = ready.get_future();
+    submit([&ready] {
+        ready.set_value();
+    });
+    future.wait();
+}
+
+void ov::hetero::PipelineStage::release() {
+    ov::threading::Task next;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto now = Clock::now();
+        OPENVINO_ASSERT(m_in_flight != 0, "Pipeline stage on ", m_device, " has no running subrequests");
+        ++m_inferences;
+        if (!m_queue.empty()) {
+            // the slot is passed to the next subrequest, so the stage stays busy
+            auto waiting = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_wait_time += now - waiting.submitted;
+            next = std::move(waiting.task);
+        } else if (--m_in_flight == 0) {
+            m_busy_time += now - m_busy_start;
+        }
+    }
+    if (next)
+        next();
+}
+
+ov::AnyMap ov::hetero::PipelineStage::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto now = Clock::now();
+    auto busy_time = m_busy_time;
+    if (m_in_flight != 0)
+        busy_time += now - m_busy_start;
+    const auto total_time = m_first_start == Clock::time_point{} ? Clock::duration{0} : now - m_first_start;
+    const double utilization = total_time.count() != 0 ? to_ms(busy_time) / to_ms(total_time) : 0.0;
+    const double average_wait = m_inferences != 0 ? to_ms(m_wait_time) / m_inferences : 0.0;
+    return {{"DEVICE", m_device},
+            {"DEPTH", m_depth},
+            {"INFERENCES", m_inferences},
+            {"IN_FLIGHT", m_in_flight},
+            {"QUEUE_SIZE", m_queue.size()},
+            {"MAX_QUEUE_SIZE", m_max_queue_size},
+            {"BUSY_TIME_MS", to_ms(busy_time)},
+            {"AVERAGE_WAIT_TIME_MS", average_wait},
+            {"UTILIZATION", utilization}};
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+
+#include "openvino/core/any.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * @brief Execution stage of a submodel shared by all the infer requests of the compiled model.
+ * The stage runs up to `depth` subrequests at the same time and the rest wait in the FIFO queue,
+ * so the stages of the different infer requests overlap like in a pipeline. 0 depth means no limit.
+ */
+class PipelineStage {
+public:
+    PipelineStage(std::string device, size_t depth);
+
+    /**
+     * @brief Runs the task when the stage has a free slot: immediately or from the thread which releases the slot.
+     * The task starts the subrequest and release() must be called when the subrequest is done.
+     */
+    void submit(ov::threading::Task task);
+
+    /**
+     * @brief Blocks until the stage has a free slot, used by the synchronous inference
+     */
+    void acquire();
+
+    /**
+     * @brief Frees the slot of the finished subrequest and starts the next waiting one
+     */
+    void release();
+
+    /**
+     * @brief Returns the utilization statistics of the stage
+     */
+    ov::AnyMap get_statistics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct WaitingTask {
+        ov::threading::Task task;
+        Clock::time_point submitted;
+    };
+
+    // should be called under the mutex
+    void start(Clock::time_point now);
+
+    const std::string m_device;
+    const size_t m_depth;
+
+    mutable std::mutex m_mutex;
+    std::deque<WaitingTask> m_queue;
+    size_t m_in_flight = 0;
+
+    size_t m_inferences = 0;
+    size_t m_max_queue_size = 0;
+    Clock::time_point m_first_start;
+    Clock::time_point m_busy_start;
+    // the time when at least one subrequest is running
+    Clock::duration m_busy_time{0};
+    // the total time spent by the subrequests in the queue
+    Clock::duration m_wait_time{0};
+};
+
+}  // namespace hetero
+}  // namespace ov
@@ -18,5 +18,16 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
 
+/**
+ * @brief The maximum number of infer requests executed by each submodel at the same time, the rest of the requests
+ * wait in the queue of the submodel, so the submodels of different requests run as a pipeline. 0 means no limit.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> pipeline_depth{"HETERO_PIPELINE_DEPTH"};
+
+/**
+ * @brief Read-only property with the utilization statistics of the submodels pipeline stages
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> pipeline_statistics{"HETERO_PIPELINE_STATISTICS"};
+
 }  // namespace hetero
 }  // namespace ov
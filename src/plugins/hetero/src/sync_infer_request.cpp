@@ -16,7 +16,8 @@
 #include "plugin.hpp"
 
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
-    : ov::ISyncInferRequest(compiled_model) {
+    : ov::ISyncInferRequest(compiled_model),
+      m_pipeline_stages(compiled_model->m_pipeline_stages) {
     for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
         auto& comp_model = comp_model_desc.compiled_model;
         m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
@@ -111,9 +112,18 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
-    for (auto&& request : m_subrequests) {
+    for (size_t i = 0; i < m_subrequests.size(); ++i) {
+        auto& request = m_subrequests[i];
         OPENVINO_ASSERT(request);
-        request->infer();
+        auto& stage = m_pipeline_stages[i];
+        stage->acquire();
+        try {
+            request->infer();
+        } catch (...) {
+            stage->release();
+            throw;
+        }
+        stage->release();
     }
 }
 
@@ -15,6 +15,7 @@
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "pipeline_stage.hpp"
 
 namespace ov {
 namespace hetero {
@@ -51,6 +52,7 @@ private:
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
+    std::vector<std::shared_ptr<PipelineStage>> m_pipeline_stages;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
 };
 
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "hetero_tests.hpp"
+
+using namespace ov::hetero::tests;
+
+TEST_F(HeteroTests, pipelined_infer_requests) {
+    auto model = create_model_with_subtract();
+    auto compiled_model =
+        core.compile_model(model, "HETERO", {ov::device::priorities("MOCK0,MOCK1"), {"HETERO_PIPELINE_DEPTH", 1}});
+    EXPECT_EQ(1, compiled_model.get_property("HETERO_PIPELINE_DEPTH").as<uint32_t>());
+
+    auto input_tensor =
+        create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+    constexpr size_t num_requests = 4;
+    std::vector<ov::InferRequest> infer_requests;
+    for (size_t i = 0; i < num_requests; i++) {
+        infer_requests.emplace_back(compiled_model.create_infer_request());
+        infer_requests.back().set_input_tensor(input_tensor);
+    }
+    for (auto& infer_request : infer_requests) {
+        infer_request.start_async();
+    }
+    for (auto& infer_request : infer_requests) {
+        infer_request.wait();
+        auto output_tensor = infer_request.get_output_tensor();
+        EXPECT_EQ(input_tensor.get_shape(), output_tensor.get_shape());
+        EXPECT_EQ(memcmp(input_tensor.data(), output_tensor.data(), input_tensor.get_byte_size()), 0);
+    }
+    // the synchronous inference goes through the same stages
+    infer_requests.front().infer();
+
+    auto statistics = compiled_model.get_property("HETERO_PIPELINE_STATISTICS").as<ov::AnyMap>();
+    ASSERT_EQ(2, statistics.size());
+    std::set<std::string> devices;
+    for (const auto& stage : statistics) {
+        auto stage_statistics = stage.second.as<ov::AnyMap>();
+        devices.insert(stage_statistics.at("DEVICE").as<std::string>());
+        EXPECT_EQ(1, stage_statistics.at("DEPTH").as<size_t>());
+        EXPECT_EQ(num_requests + 1, stage_statistics.at("INFERENCES").as<size_t>());
+        EXPECT_EQ(0, stage_statistics.at("IN_FLIGHT").as<size_t>());
+        EXPECT_EQ(0, stage_statistics.at("QUEUE_SIZE").as<size_t>());
+        EXPECT_LE(stage_statistics.at("MAX_QUEUE_SIZE").as<size_t>(), num_requests - 1);
+        const auto utilization = stage_statistics.at("UTILIZATION").as<double>();
+        EXPECT_GE(utilization, 0.0);
+        EXPECT_LE(utilization, 1.0);
+    }
+    EXPECT_EQ((std::set<std::string>{"MOCK0.0", "MOCK1.0"}), devices);
+}
+
+TEST_F(HeteroTests, pipeline_depth_is_unlimited_by_default) {
+    auto model = create_model_with_subtract();
+    auto compiled_model = core.compile_model(model, "HETERO", ov::device::priorities("MOCK0,MOCK1"));
+    EXPECT_EQ(0, compiled_model.get_property("HETERO_PIPELINE_DEPTH").as<uint32_t>());
+
+    auto infer_request = compiled_model.create_infer_request();
+    infer_request.set_input_tensor(
+        create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape()));
+    infer_request.infer();
+
+    auto statistics = compiled_model.get_property("HETERO_PIPELINE_STATISTICS").as<ov::AnyMap>();
+    for (const auto& stage : statistics) {
+        auto stage_statistics = stage.second.as<ov::AnyMap>();
+        EXPECT_EQ(1, stage_statistics.at("INFERENCES").as<size_t>());
+        EXPECT_EQ(0, stage_statistics.at("MAX_QUEUE_SIZE").as<size_t>());
+    }
+}
@@ -8,10 +8,12 @@
 using namespace ov::hetero::tests;
 
 TEST_F(HeteroTests, get_property_supported_properties) {
-    const std::vector<ov::PropertyName> supported_properties = {ov::supported_properties,
-                                                                ov::device::full_name,
-                                                                ov::device::capabilities,
-                                                                ov::device::priorities};
+    const std::vector<ov::PropertyName> supported_properties = {
+        ov::supported_properties,
+        ov::device::full_name,
+        ov::device::capabilities,
+        ov::device::priorities,
+        ov::PropertyName("HETERO_PIPELINE_DEPTH", ov::PropertyMutability::RW)};
     auto actual_supported_properties = core.get_property("HETERO", ov::supported_properties);
     EXPECT_EQ(supported_properties.size(), actual_supported_properties.size());
     for (auto& supported_property : supported_properties) {
@@ -40,7 +42,8 @@ TEST_F(HeteroTests, get_property_supported_metrics) {
 TEST_F(HeteroTests, get_property_supported_configs) {
     const std::vector<std::string> supported_configs = {"HETERO_DUMP_GRAPH_DOT",
                                                         "TARGET_FALLBACK",
-                                                        ov::device::priorities.name()};
+                                                        ov::device::priorities.name(),
+                                                        "HETERO_PIPELINE_DEPTH"};
     auto actual_supported_configs =
         core.get_property("HETERO", METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
     EXPECT_EQ(supported_configs.size(), actual_supported_configs.size());
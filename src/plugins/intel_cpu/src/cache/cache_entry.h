@@ -19,14 +19,15 @@ public:
     };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual size_t getSize() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&)
+ *         and size_t getSize() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -66,6 +67,10 @@ public:
         return {retVal, retStatus};
     }
 
+    size_t getSize() const override {
+        return _impl.getSize();
+    }
+
 public:
     ImplType _impl;
 };
@@ -85,6 +85,13 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of stored records
+     */
+    size_t getSize() const noexcept {
+        return _cacheMapper.size();
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,13 +17,16 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention The default (per stream) implementation IS NOT THREAD SAFE! The cache created with the threadSafe flag
+ *            may be shared between streams: its entries are backed by ShardedLruCache.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template<typename KeyType, typename ValueType>
+    using SharedEntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
@@ -29,9 +34,16 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe allows to use the cache from several streams concurrently
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
+
+    // the entries are shared with the copy, the storage of the thread safe cache is read under its lock
+    MultiCache(const MultiCache& other)
+        : _capacity(other._capacity),
+          _threadSafe(other._threadSafe),
+          _storage(copyStorage(other)) {}
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,19 +57,52 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (_threadSafe) {
+            auto entry = getEntry<SharedEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    bool isThreadSafe() const noexcept {
+        return _threadSafe;
+    }
+
+    /**
+     * @brief Returns the number of records stored for all the Key/Value types
+     */
+    size_t getSize() const {
+        std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+        if (_threadSafe) {
+            lock.lock();
+        }
+        size_t size = 0;
+        for (const auto& entry : _storage) {
+            size += entry.second->getSize();
+        }
+        return size;
+    }
+
 private:
+    static std::unordered_map<size_t, EntryBasePtr> copyStorage(const MultiCache& other) {
+        std::unique_lock<std::mutex> lock(other._storageMutex, std::defer_lock);
+        if (other._threadSafe) {
+            lock.lock();
+        }
+        return other._storage;
+    }
+
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _threadSafe;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -67,10 +112,13 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_threadSafe) {
+        lock.lock();
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
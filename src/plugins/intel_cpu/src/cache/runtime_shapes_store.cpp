@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runtime_shapes_store.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr uint64_t storeMagic = 0x5350414853545243ull;
+constexpr uint64_t storeVersion = 1;
+// sanity limits protecting from huge allocations on corrupted files
+constexpr uint64_t maxNameSize = 4096;
+constexpr uint64_t maxRank = 64;
+
+template <typename T>
+void writeValue(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readValue(std::istream& is, T& value) {
+    is.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return static_cast<bool>(is);
+}
+}   // namespace
+
+RuntimeShapesStore::RuntimeShapesStore(std::string filePath, size_t maxRecords, size_t flushPeriod)
+    : m_filePath(std::move(filePath)),
+      m_maxRecords(maxRecords),
+      m_flushPeriod(flushPeriod) {
+    load();
+}
+
+RuntimeShapesStore::~RuntimeShapesStore() {
+    try {
+        flush();
+    } catch (...) {
+        // the store is an optimization only, failing to write it must not break the application
+    }
+}
+
+bool RuntimeShapesStore::add(const InputShapes& shapes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_records.size() >= m_maxRecords || !m_records.insert(shapes).second) {
+        return false;
+    }
+    if (++m_unsaved == m_flushPeriod) {
+        save();
+        m_unsaved = 0;
+    }
+    return true;
+}
+
+std::vector<RuntimeShapesStore::InputShapes> RuntimeShapesStore::getRecords() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {m_records.begin(), m_records.end()};
+}
+
+void RuntimeShapesStore::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_unsaved == 0) {
+        return;
+    }
+    save();
+    m_unsaved = 0;
+}
+
+std::string RuntimeShapesStore::getFilePath(const std::string& cacheDir, const std::string& modelKey) {
+    return ov::util::path_join({cacheDir, modelKey + ".cpu_rt_shapes"});
+}
+
+void RuntimeShapesStore::load() {
+    std::ifstream is(m_filePath, std::ios::binary);
+    if (!is.is_open()) {
+        return;
+    }
+    // a corrupted or outdated file is ignored: all the records read so far are kept, the rest are dropped
+    uint64_t magic = 0, version = 0, recordsNum = 0;
+    if (!readValue(is, magic) || magic != storeMagic || !readValue(is, version) || version != storeVersion ||
+        !readValue(is, recordsNum)) {
+        return;
+    }
+    for (uint64_t r = 0; r < recordsNum && m_records.size() < m_maxRecords; ++r) {
+        uint64_t inputsNum = 0;
+        if (!readValue(is, inputsNum))
+            return;
+        InputShapes record;
+        for (uint64_t i = 0; i < inputsNum; ++i) {
+            uint64_t nameSize = 0, rank = 0;
+            if (!readValue(is, nameSize) || nameSize > maxNameSize)
+                return;
+            std::string name(nameSize, '\0');
+            if (!is.read(&name[0], nameSize) || !readValue(is, rank) || rank > maxRank)
+                return;
+            VectorDims dims(rank);
+            for (auto& dim : dims) {
+                uint64_t value = 0;
+                if (!readValue(is, value))
+                    return;
+                dim = static_cast<Dim>(value);
+            }
+            record.emplace(std::move(name), std::move(dims));
+        }
+        m_records.insert(std::move(record));
+    }
+}
+
+void RuntimeShapesStore::save() const {
+    // write to a temporary file first, so concurrent processes never read a partially written store
+    const auto tmpPath = m_filePath + ".tmp";
+    {
+        std::ofstream os(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!os.is_open()) {
+            return;
+        }
+        writeValue(os, storeMagic);
+        writeValue(os, storeVersion);
+        writeValue(os, static_cast<uint64_t>(m_records.size()));
+        for (const auto& record : m_records) {
+            writeValue(os, static_cast<uint64_t>(record.size()));
+            for (const auto& input : record) {
+                writeValue(os, static_cast<uint64_t>(input.first.size()));
+                os.write(input.first.data(), input.first.size());
+                writeValue(os, static_cast<uint64_t>(input.second.size()));
+                for (const auto dim : input.second) {
+                    writeValue(os, static_cast<uint64_t>(dim));
+                }
+            }
+        }
+        if (!os) {
+            return;
+        }
+    }
+#ifdef _WIN32
+    std::remove(m_filePath.c_str());
+#endif
+    std::rename(tmpPath.c_str(), m_filePath.c_str());
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Persistent set of the input shapes a dynamic-shape compiled model has been inferred with.
+ *
+ * oneDNN primitives and JIT kernels cannot be serialized, so the runtime cache itself is not stored on disk.
+ * Instead the store keeps the input shapes seen at runtime, so the next process compiling the same model can
+ * pre-warm the runtime cache by running the graph on these shapes at compile_model time.
+ *
+ * Is a thread safe
+ */
+class RuntimeShapesStore {
+public:
+    using Ptr = std::shared_ptr<RuntimeShapesStore>;
+    using InputShapes = std::map<std::string, VectorDims>;
+
+    /**
+     * @param filePath is the file the records are loaded from and stored to
+     * @param maxRecords is the maximum number of distinct input shape combinations to store
+     * @param flushPeriod is the number of new records after which the store is written to the file,
+     *        zero means the store is written only on destruction
+     */
+    RuntimeShapesStore(std::string filePath, size_t maxRecords = 64, size_t flushPeriod = 8);
+    ~RuntimeShapesStore();
+
+    RuntimeShapesStore(const RuntimeShapesStore&) = delete;
+    RuntimeShapesStore& operator=(const RuntimeShapesStore&) = delete;
+
+    /**
+     * @brief Registers input shapes of an inference
+     * @return true if the record has not been seen before and was added
+     */
+    bool add(const InputShapes& shapes);
+
+    std::vector<InputShapes> getRecords() const;
+
+    size_t getMaxRecords() const noexcept {
+        return m_maxRecords;
+    }
+
+    /**
+     * @brief Writes all the records to the file
+     */
+    void flush();
+
+    /**
+     * @brief Builds the store file name for a model in the cache directory
+     */
+    static std::string getFilePath(const std::string& cacheDir, const std::string& modelKey);
+
+private:
+    void load();
+    void save() const;
+
+    mutable std::mutex m_mutex;
+    std::string m_filePath;
+    size_t m_maxRecords;
+    size_t m_flushPeriod;
+    size_t m_unsaved = 0;
+    std::set<InputShapes> m_records;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @brief Thread safe cache with LRU eviction policy, split into independently locked shards.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * The capacity is the maximum number of records, the same as for LruCache. It is split evenly between the shards
+ * and each shard evicts its own least recently used records.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+    static constexpr size_t defaultShardsNum = 16;
+
+public:
+    explicit ShardedLruCache(size_t capacity, size_t shardsNum = defaultShardsNum)
+        : _capacity(capacity),
+          _shardsNum(std::max<size_t>(std::min(shardsNum, capacity), 1)),
+          _shards(new Shard[_shardsNum]) {
+        // the remainder of the capacity goes to the first shards, so the shards hold exactly capacity records
+        for (size_t s = 0; s < _shardsNum; ++s) {
+            _shards[s].capacity = _capacity / _shardsNum + (s < _capacity % _shardsNum ? 1 : 0);
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key &key, const Value &val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (0 == shard.capacity) {
+            return;
+        }
+        auto mapItr = shard.cacheMapper.find(key);
+        if (mapItr != shard.cacheMapper.end()) {
+            shard.lruList.erase(mapItr->second);
+            shard.cacheMapper.erase(mapItr);
+        }
+        if (shard.cacheMapper.size() == shard.capacity) {
+            shard.evictOne();
+        }
+        auto itr = shard.lruList.insert(shard.lruList.begin(), {key, val});
+        shard.cacheMapper.insert({key, itr});
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto itr = shard.cacheMapper.find(key);
+        if (itr == shard.cacheMapper.end()) {
+            return Value();
+        }
+
+        shard.lruList.splice(shard.lruList.begin(), shard.lruList, itr->second);
+        return shard.lruList.front().second;
+    }
+
+    /**
+     * @brief Evicts up to n least recently used cache records from every shard
+     * @param n number of records to be evicted from each shard, can be greater than the number of stored records
+     */
+
+    void evict(size_t n) {
+        for (size_t s = 0; s < _shardsNum; ++s) {
+            auto& shard = _shards[s];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (size_t i = 0; i < n && !shard.lruList.empty(); ++i) {
+                shard.evictOne();
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the maximum number of records
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of stored records
+     */
+    size_t getSize() const {
+        size_t size = 0;
+        for (size_t s = 0; s < _shardsNum; ++s) {
+            std::lock_guard<std::mutex> lock(_shards[s].mutex);
+            size += _shards[s].cacheMapper.size();
+        }
+        return size;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const Key &k) const {
+            return k.hash();
+        }
+    };
+
+    using lru_list_type = std::list<value_type>;
+
+    struct Shard {
+        void evictOne() {
+            cacheMapper.erase(lruList.back().first);
+            lruList.pop_back();
+        }
+
+        mutable std::mutex mutex;
+        lru_list_type lruList;
+        std::unordered_map<Key, typename lru_list_type::iterator, key_hasher> cacheMapper;
+        size_t capacity = 0;
+    };
+
+    Shard& getShard(const Key& key) {
+        // the lower bits of the hash select the bucket inside the shard map, so mix in the higher ones
+        // to keep the shard choice independent from the bucket choice
+        const uint64_t hash = static_cast<uint64_t>(key.hash()) * 0x9E3779B97F4A7C15ull;
+        return _shards[static_cast<size_t>(hash >> 32) % _shardsNum];
+    }
+
+    size_t _capacity;
+    size_t _shardsNum;
+    std::unique_ptr<Shard[]> _shards;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
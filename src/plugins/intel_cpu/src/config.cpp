@@ -217,6 +217,19 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, cons
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE_CAPACITY == key) {
+            int64_t val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means using per stream caches
+            rtSharedCacheCapacity = static_cast<size_t>(std::max<int64_t>(val_i, 0));
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_DIR == key) {
+            rtCacheDir = val;
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
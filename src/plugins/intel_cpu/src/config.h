@@ -62,6 +62,11 @@ struct Config {
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    // maximum number of records per runtime parameter type in the cache shared between streams,
+    // zero means per stream caches are used
+    size_t rtSharedCacheCapacity = 0ul;
+    // directory to persist the input shapes of dynamic models for the runtime cache warm up, empty means disabled
+    std::string rtCacheDir = {};
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
     bool enableCpuPinning = true;
@@ -27,10 +27,13 @@
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
 
 #include <algorithm>
+#include <sstream>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -38,6 +41,23 @@
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+// Cheap structural fingerprint of the model used to name the runtime shapes store. A collision can only lead to
+// an useless warm up, since the records which are incompatible with the model inputs are skipped.
+std::string getRuntimeShapesKey(const std::shared_ptr<const ov::Model>& model) {
+    std::ostringstream fingerprint;
+    fingerprint << model->get_friendly_name();
+    for (const auto& op : model->get_ordered_ops()) {
+        fingerprint << ';' << op->get_type_info().name << ':' << op->get_friendly_name();
+        for (const auto& input : op->inputs()) {
+            fingerprint << ',' << input.get_element_type() << input.get_partial_shape();
+        }
+    }
+    const auto str = fingerprint.str();
+    return std::to_string(ov::runtime::compute_hash(str.data(), str.size()));
+}
+}   // namespace
+
 namespace ov {
 namespace intel_cpu {
 
@@ -66,12 +86,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
+                         const std::shared_ptr<SocketsWeights>& sharedWeights,
                          const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _sharedSocketWeights(sharedWeights) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -114,6 +136,15 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (_cfg.rtSharedCacheCapacity != 0) {
+        for (int socket_id = 0; socket_id < get_num_sockets(); socket_id++)
+            _socketParamsCaches[socket_id] = std::make_shared<MultiCache>(_cfg.rtSharedCacheCapacity, true);
+    }
+    if (!_cfg.rtCacheDir.empty() && function->is_dynamic()) {
+        ov::util::create_directory_recursive(_cfg.rtCacheDir);
+        _rtShapesStore = std::make_shared<RuntimeShapesStore>(
+            RuntimeShapesStore::getFilePath(_cfg.rtCacheDir, getRuntimeShapesKey(function)));
+    }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -134,6 +165,9 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    if (_rtShapesStore) {
+        WarmUpGraphs();
+    }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -153,7 +187,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(
+                    new VariableState(state_name, state_store, memoryNode->getOutputShapeAtPort(0)));
             }
         }
     }
@@ -177,12 +212,25 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     // disable weights caching if graph was created only once
                     auto weightsCache = _cfg.streamExecutorConfig._streams != 1 ? _socketWeights[socketId] : nullptr;
+                    // the packed weights are shared by content with the other compiled models of the plugin,
+                    // whatever the number of streams is
+                    auto sharedWeightsCache = _sharedSocketWeights ? (*_sharedSocketWeights)[socketId] : nullptr;
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    auto paramsCacheItr = _socketParamsCaches.find(socketId);
+                    auto paramsCache =
+                        paramsCacheItr != _socketParamsCaches.end() ? paramsCacheItr->second : nullptr;
+
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         paramsCache,
+                                                         sharedWeightsCache,
+                                                         _weightsHashes);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -201,6 +249,44 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+void ExecNetwork::WarmUpGraphs() {
+    const auto records = _rtShapesStore->getRecords();
+    if (records.empty())
+        return;
+
+    // each graph is warmed up inside its own stream, so the primitives are created for the right threading context
+    std::vector<bool> warmedUp(_graphs.size(), false);
+    std::mutex warmedUpMutex;
+    auto warmUp = [&] {
+        auto graphLock = GetGraph();
+        {
+            std::lock_guard<std::mutex> lock(warmedUpMutex);
+            size_t idx = 0;
+            while (&_graphs[idx] != &graphLock._graph)
+                idx++;
+            if (warmedUp[idx])
+                return;
+            warmedUp[idx] = true;
+        }
+        graphLock._graph.WarmUp(records);
+    };
+    auto allWarmedUp = [&] {
+        std::lock_guard<std::mutex> lock(warmedUpMutex);
+        return std::all_of(warmedUp.begin(), warmedUp.end(), [](bool value) {
+            return value;
+        });
+    };
+
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        std::vector<Task> tasks(_graphs.size(), warmUp);
+        do {
+            _taskExecutor->runAndWait(tasks);
+        } while (!allWarmedUp());
+    } else {
+        warmUp();
+    }
+}
+
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
 }
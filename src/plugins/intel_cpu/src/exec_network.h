@@ -10,6 +10,7 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "cache/runtime_shapes_store.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -37,6 +38,7 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
+                const std::shared_ptr<SocketsWeights>& sharedWeights,
                 const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
@@ -69,6 +71,14 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable SocketsWeights                      _socketWeights;
+    // packed weights caches shared between all the compiled models of the plugin
+    std::shared_ptr<SocketsWeights>             _sharedSocketWeights;
+    // content hashes of the constants computed once for the graphs of all the streams
+    WeightsHashes::Ptr                          _weightsHashes = std::make_shared<WeightsHashes>();
+    // runtime parameters caches shared between the streams of the same socket (if enabled)
+    std::map<int, MultiCachePtr>                _socketParamsCaches;
+    // input shapes of the dynamic model persisted to warm up the runtime parameters caches (if enabled)
+    RuntimeShapesStore::Ptr                     _rtShapesStore;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -76,6 +86,8 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    void WarmUpGraphs();
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 #include <map>
 #include <vector>
@@ -48,6 +49,7 @@
 #include <openvino/core/model.hpp>
 #include <openvino/core/node.hpp>
 #include <openvino/op/ops.hpp>
+#include <openvino/util/log.hpp>
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -775,7 +777,8 @@ void Graph::AllocateWithReuse() {
         for (auto &edge : edge_clusters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Type::Output;
-            isInput  |= edge->getParent()->getType() == Type::Input;
+            // the memory state may be read in place, so the state memory must not be shared with other tensors
+            isInput  |= one_of(edge->getParent()->getType(), Type::Input, Type::MemoryInput);
         }
 
         if (reuse_io_tensors) {
@@ -982,7 +985,10 @@ bool Graph::ProcessDynNodes() {
                 // may happen when the second term shape is broadcasted to the output tensor shape. To avoid the data loss, we have a special processing for
                 // such cases inside the convolution node, but it works properly only when dynamic shapes inference, preparation and execution a called
                 // for this node sequentially.
-                (node->getType() == Type::Convolution && node->isInPlace())) {
+                (node->getType() == Type::Convolution && node->isInPlace()) ||
+                // The output shape of the memory input is the shape of the state or the initializer, which is known
+                // only at the execution, since the state might be reset.
+                node->getType() == Type::MemoryInput) {
                 syncNodesInds.insert({node.get(), i});
             }
         }
@@ -1389,6 +1395,44 @@ void Graph::Infer(InferRequestBase* request) {
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::WarmUp(const std::vector<std::map<std::string, VectorDims>>& inputShapes) {
+    if (Status::ReadyDynamic != status)
+        return;
+
+    // memory nodes keep data between inferences, so stateful graphs must not be run on fake inputs
+    if (std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+            return node->getType() == Type::MemoryInput;
+        }))
+        return;
+
+    for (const auto& shapes : inputShapes) {
+        bool compatible = shapes.size() == inputNodesMap.size();
+        for (const auto& input : inputNodesMap) {
+            auto shape = shapes.find(input.first);
+            compatible = compatible && shape != shapes.end() &&
+                         input.second->getOutputShapeAtPort(0).isCompatible(shape->second);
+        }
+        if (!compatible)
+            continue;
+
+        try {
+            for (const auto& input : inputNodesMap) {
+                const auto& node = input.second;
+                if (node->isDynamicNode())
+                    node->redefineOutputMemory({shapes.at(input.first)});
+                const auto& memory = node->getChildEdgeAt(0)->getMemory();
+                std::memset(memory.getData(), 0, memory.getSize());
+            }
+            InferDynamic(nullptr);
+        } catch (const std::exception& e) {
+            // warming up is an optimization only, the shape will be handled as usual on a real inference
+            OPENVINO_WARN << "CPU graph " << GetName() << " failed to warm up the runtime cache: " << e.what();
+        } catch (...) {
+            OPENVINO_WARN << "CPU graph " << GetName() << " failed to warm up the runtime cache";
+        }
+    }
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -65,6 +65,13 @@ public:
 
     void Infer(InferRequestBase* request = nullptr);
 
+    /**
+     * @brief Runs the dynamic graph on zero filled inputs of the given shapes to populate the runtime cache
+     *        before the first inference. Stateful graphs and static graphs are not affected.
+     * @param inputShapes is the list of input shape combinations, each of them maps input names to dims
+     */
+    void WarmUp(const std::vector<std::map<std::string, VectorDims>>& inputShapes);
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -21,12 +21,21 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 MultiCachePtr sharedParamsCache = nullptr,
+                 WeightsSharing::Ptr sharedWeightsCache = nullptr,
+                 WeightsHashes::Ptr weightsHashes = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          sharedWeightsCache(sharedWeightsCache),
+          weightsHashes(weightsHashes),
+          rtParamsCache(sharedParamsCache),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!rtParamsCache)
+            rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!this->weightsHashes)
+            this->weightsHashes = std::make_shared<WeightsHashes>();
         rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine());
     }
 
@@ -42,6 +51,13 @@ public:
         return weightsCache;
     }
 
+    WeightsSharing::Ptr getSharedWeightsCache() const {
+        return sharedWeightsCache;
+    }
+
+    WeightsHashes::Ptr getWeightsHashes() const {
+        return weightsHashes;
+    }
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
@@ -62,8 +78,10 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsSharing::Ptr sharedWeightsCache;   // per NUMA node caches for sharing packed weights between compiled models
+    WeightsHashes::Ptr weightsHashes;         // content hashes of the constants (shared between streams)
 
-    MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr rtParamsCache;     // primitive cache (per stream or shared between streams of the socket)
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
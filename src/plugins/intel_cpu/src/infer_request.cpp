@@ -28,6 +28,7 @@
 #include "proxy_mem_mgr.h"
 #include "openvino/runtime/make_tensor.hpp"
 #include <utils/general_utils.h>
+#include <common/primitive_hashing_utils.hpp>
 
 namespace ov {
 namespace intel_cpu {
@@ -59,7 +60,7 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name, state_store, memoryNode->getOutputShapeAtPort(0)));
         }
     }
 }
@@ -95,50 +96,66 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
-void InferRequestBase::PushStates() {
+void InferRequestBase::AssignStates() {
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
+        if (!one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput))
+            continue;
+        auto cur_node = dynamic_cast<node::MemoryNode*>(node.get());
+        if (!cur_node) {
+            IE_THROW() << "Cannot cast " << node->getName() << " to MemoryNode";
+        }
+        auto cur_id = cur_node->getId();
+        // Remove suffix with pair ID. Internal information.
+        auto suffix_idx = cur_id.find("/id=");
+        if (suffix_idx != std::string::npos)
+            cur_id = cur_id.substr(0, suffix_idx);
+
+        VariableStatePtr cur_state;
+        for (const auto& state : memoryStates) {
+            if (state->GetName() == cur_id) {
+                cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                break;
             }
         }
+        cur_node->assignState(cur_state);
     }
 }
 
-void InferRequestBase::PullStates() {
+void InferRequestBase::CommitStates() {
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
             if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
             }
+            cur_node->commitState();
         }
     }
 }
 
+void InferRequestBase::recordInputShapes() {
+    const auto& store = execNetwork->_rtShapesStore;
+    // every shapes combination recorded by the request is in the store, so the store is full
+    if (_recordedShapes.size() >= store->getMaxRecords())
+        return;
+
+    // the store is locked only for the shapes this request has not seen yet
+    size_t seed = 0;
+    for (const auto& blob : _inputs) {
+        const auto& dims = blob.second->getTensorDesc().getDims();
+        seed = dnnl::impl::hash_combine(seed, dims.size());
+        for (const auto dim : dims)
+            seed = dnnl::impl::hash_combine(seed, dim);
+    }
+    if (!_recordedShapes.insert(seed).second)
+        return;
+
+    RuntimeShapesStore::InputShapes shapes;
+    for (const auto& blob : _inputs)
+        shapes.emplace(blob.first, blob.second->getTensorDesc().getDims());
+    store->add(shapes);
+}
+
 void InferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
@@ -163,6 +180,8 @@ void InferRequestBase::InferImpl() {
 
     if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
+        if (execNetwork->_rtShapesStore)
+            recordInputShapes();
     }
 
     execDataPreprocessing(_inputs);
@@ -174,13 +193,13 @@ void InferRequestBase::InferImpl() {
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
+        AssignStates();
     }
 
     graph->Infer(this);
 
     if (memoryStates.size() != 0) {
-        PullStates();
+        CommitStates();
     }
 
     ThrowIfCanceled();
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include "cpu_tensor.h"
 
@@ -114,14 +115,17 @@ protected:
     std::unordered_map<std::string, OutputControlBlock> outputControlBlocks;
 
 private:
-    void PushStates();
-    void PullStates();
+    void AssignStates();
+    void CommitStates();
     void redefineMemoryForInputNodes();
+    void recordInputShapes();
 
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    // hashes of the input shapes this request has already passed to the runtime shapes store
+    std::unordered_set<size_t>          _recordedShapes;
 
 protected:
     virtual void changeDefaultPtr();
@@ -6,15 +6,116 @@
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage, const Shape& shape)
+    : InferenceEngine::IVariableStateInternal{name}, m_shape(shape) {
+    auto memory = std::dynamic_pointer_cast<Memory>(storage);
+    IE_ASSERT(memory) << "Unexpected memory type of the variable state " << name;
+    m_initial_desc = memory->getDescPtr();
+    for (size_t i = 0; i < m_internal_mem.size(); i++) {
+        m_internal_mem[i] = std::make_shared<Memory>(memory->getEngine(), m_initial_desc);
+        m_capacity[i] = m_internal_mem[i]->getSize();
+    }
+    if (m_shape.isDynamic() && m_shape.hasDefinedUpperBounds())
+        m_max_size = m_initial_desc->cloneWithNewDims(m_shape.getMaxDims(), true)->getCurrentMemSize();
+    cpu_memcpy(inputMem()->getData(), storage->getData(), storage->getSize());
+}
+
+void VariableState::redefineBuffer(size_t idx, const VectorDims& dims) {
+    auto& mem = m_internal_mem[idx];
+    if (mem->getStaticDims() == dims)
+        return;
+    // the buffer descriptors are static, while the state shape is checked by the callers
+    auto desc = mem->getDescPtr()->cloneWithNewDims(dims, true);
+    const auto size = desc->getCurrentMemSize();
+    if (size > m_capacity[idx]) {
+        // the bounded state is reserved at once, the unbounded one grows geometrically,
+        // so the growing state is reallocated only a logarithmic number of times
+        m_capacity[idx] = std::max(size, m_max_size != 0 ? m_max_size : 2 * m_capacity[idx]);
+        mem->getMemoryMngr()->resize(m_capacity[idx]);
+    }
+    mem->redefineDesc(desc);
+}
+
+void VariableState::redefineInput(const VectorDims& dims) {
+    redefineBuffer(m_buffer_idx, dims);
+}
+
+void VariableState::redefineOutput(const VectorDims& dims) {
+    redefineBuffer(m_buffer_idx ^ 1, dims);
+}
+
+bool VariableState::appendToInput(const IMemory& newValue, size_t axis) {
+    auto mem = inputMem();
+    const auto& dims = mem->getStaticDims();
+    const auto& newDims = newValue.getStaticDims();
+    if (newValue.getDesc().getPrecision() != mem->getDesc().getPrecision() || newDims.size() != dims.size() ||
+        axis >= dims.size() || newDims[axis] < dims[axis] || newValue.getSize() > inputCapacity())
+        return false;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (i != axis && newDims[i] != dims[i])
+            return false;
+    }
+
+    // The planar value is the sequence of the rows along the axis, so each row of the new value is the row
+    // of the current one followed by the new data. The rows are extended from the last one: the current row
+    // is moved to its new position, which doesn't overlap the preceding rows, and only the new data is copied.
+    const size_t outer = std::accumulate(dims.begin(), dims.begin() + axis, size_t{1}, std::multiplies<size_t>());
+    const size_t inner = std::accumulate(dims.begin() + axis + 1, dims.end(), size_t{1}, std::multiplies<size_t>()) *
+                         mem->getDesc().getPrecision().size();
+    const size_t rowSize = dims[axis] * inner;
+    const size_t newRowSize = newDims[axis] * inner;
+
+    // the current buffer is not reallocated within its capacity, so the consumers reading
+    // the current value in place are not affected
+    mem->redefineDesc(mem->getDescPtr()->cloneWithNewDims(newDims, true));
+    auto dst = static_cast<uint8_t*>(mem->getData());
+    auto src = static_cast<const uint8_t*>(newValue.getData());
+    for (size_t i = outer; i-- > 0;) {
+        if (i != 0 && rowSize != 0)
+            std::memmove(dst + i * newRowSize, dst + i * rowSize, rowSize);
+        cpu_memcpy(dst + i * newRowSize + rowSize, src + i * newRowSize + rowSize, newRowSize - rowSize);
+    }
+    m_appended = true;
+    return true;
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    if (m_shape.isDynamic())
+        redefineInput(m_initial_desc->getShape().getStaticDims());
+    inputMem()->nullify();
+    m_reset = true;
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    const auto& dims = newState->getTensorDesc().getDims();
+    if (m_shape.isDynamic()) {
+        if (!m_shape.isCompatible(dims))
+            IE_THROW() << "Variable state " << name << " has the shape " << m_shape.toString()
+                       << ", which is not compatible with the new state shape " << Shape(dims).toString();
+        redefineInput(dims);
+    }
+    auto mem = inputMem();
+    if (newState->byteSize() != mem->getSize())
+        IE_THROW() << "Variable state " << name << " has the size " << mem->getSize()
+                   << " bytes, while the new state has " << newState->byteSize() << " bytes";
+    cpu_memcpy(mem->getData(), newState->cbuffer().as<const void*>(), mem->getSize());
+    m_reset = false;
+}
+
+Blob::CPtr VariableState::GetState() const {
+    auto mem = inputMem();
+    return make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(mem->getDesc()), mem->getData());
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,22 +10,76 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Double buffered variable state.
+ * The ReadValue node reads the current buffer, while the Assign node writes the next one,
+ * so the graph may work with the state memory directly and the inference result becomes
+ * the current value by swapping the buffers (see commit()).
+ * The buffers of the dynamic shape state keep spare capacity, so the growing state (e.g. the KV cache
+ * of the decoder models) is neither reallocated on each inference nor copied as a whole when the
+ * new value only extends the current one (see appendToInput()).
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->getData(), storage->getSize());
-    }
+    VariableState(std::string name, MemoryPtr storage, const Shape& shape);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    // returns the view of the current value, which is valid until the next inference
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    MemoryPtr inputMem() const {
+        return m_internal_mem[m_buffer_idx];
+    }
+    MemoryPtr outputMem() const {
+        return m_internal_mem[m_buffer_idx ^ 1];
+    }
+    // the number of bytes the current buffer may grow to without the reallocation
+    size_t inputCapacity() const {
+        return m_capacity[m_buffer_idx];
+    }
+    // the state has been reset, so the current value must be taken from the ReadValue initializer
+    bool isReset() const {
+        return m_reset;
+    }
+
+    void redefineInput(const VectorDims& dims);
+    void redefineOutput(const VectorDims& dims);
+    /**
+     * @brief writes the new value, which is the current value concatenated with the new data along the axis,
+     * by copying only the new data into the spare capacity of the current buffer
+     * @return false if the value can't be appended and must be written to the output memory
+     */
+    bool appendToInput(const IMemory& newValue, size_t axis);
+    // the value written to the output memory becomes the current one
+    void commit() {
+        if (!m_appended)
+            m_buffer_idx ^= 1;
+        m_appended = false;
+        m_reset = false;
+    }
+
+private:
+    void redefineBuffer(size_t idx, const VectorDims& dims);
+
+    std::array<MemoryPtr, 2> m_internal_mem;
+    std::array<size_t, 2> m_capacity;
+    size_t m_buffer_idx = 0;
+    Shape m_shape;
+    MemoryDescPtr m_initial_desc;
+    // the upper bound of the state size if the dynamic shape is bounded
+    size_t m_max_size = 0;
+    bool m_appended = false;
+    bool m_reset = true;
 };
 
+using VariableStatePtr = std::shared_ptr<VariableState>;
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -53,6 +53,7 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "utils/rt_info/memory_formats_attribute.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/runtime/compute_hash.hpp>
 
 #include <dnnl_types.h>
 #include <dnnl_debug.h>
@@ -819,10 +820,10 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
 
     const auto &internalBlob = internalBlobs[indx];
 
-    auto create = [&] () {
-        // TODO [DS]: internal blobs should be removed or rewritten using Memory object
-        auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
+    // TODO [DS]: internal blobs should be removed or rewritten using Memory object
+    auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
 
+    auto create = [&] () {
         Memory memory{engine, newDesc, internalBlob->buffer()};
 
         MemoryPtr _ptr = std::make_shared<Memory>(engine, intDesc);
@@ -831,16 +832,13 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     };
 
     MemoryPtr ptr;
-    auto weightCache = context->getWeightsCache();
+    auto weightCache = context->getSharedWeightsCache();
     if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
-        const auto& format = intDesc->serializeFormat();
-        const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                internalBlob->buffer(), internalBlob->byteSize());
-
-        const std::string string_hash = name + "_" + std::to_string(indx)
-                                        + "_" + format
-                                        + "_" + std::to_string(internalBlob->byteSize())
-                                        + "_" + std::to_string(data_hash);
+        // the internal blobs are built by the node, so they are hashed each time
+        const auto dataHash = ov::runtime::compute_hash(internalBlob->buffer(), internalBlob->byteSize());
+        const std::string string_hash = WeightsSharing::contentKey(
+                WeightsSharing::describe(newDesc) + "_" + WeightsSharing::describe(*intDesc),
+                dataHash, internalBlob->byteSize());
 
         ptr = *weightCache->findOrCreate(string_hash, create);
     } else {
@@ -898,11 +896,11 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     if (privateWeightCache.end() != itr) {
         ptr = itr->second;
     } else {
-        auto weightCache = context->getWeightsCache();
+        auto weightCache = context->getSharedWeightsCache();
         if (weightCache != nullptr) {
-            const std::string string_hash = getName() + "_" + format
-                                            + "_" + std::to_string(edgeMem->getSize())
-                                            + "_" + std::to_string(reinterpret_cast<uint64_t>(edgeMem->getData()));
+            const std::string string_hash = WeightsSharing::contentKey(
+                WeightsSharing::describe(*srcWeightDesc) + "_" + WeightsSharing::describe(*dstWeightDesc),
+                context->getWeightsHashes()->get(edgeMem), edgeMem->getSize());
 
             ptr = *weightCache->findOrCreate(string_hash, create);
         } else {
@@ -34,6 +34,10 @@ public:
     bool needPrepareParams() const override;
     void prepareParams() override;
 
+    size_t getAxis() const {
+        return axis;
+    }
+
 private:
     size_t axis = 0;
     size_t reorderedAxis = 0;
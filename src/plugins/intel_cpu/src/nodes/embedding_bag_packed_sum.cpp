@@ -45,11 +45,9 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -62,10 +60,19 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
 
     std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
                                                        {LayoutType::ncsp, Precision::I32}});
+    const auto outPrecision = getOutputPrecision(inDataPrecision);
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, outPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outPrecision}}, impl_desc_type::ref_any);
+}
+
+void EmbeddingBagPackedSum::createPrimitive() {
+    if (auto selectedPd = getSelectedPrimitiveDescriptor()) {
+        const auto tablePrc = selectedPd->getConfig().inConfs[EMB_TABLE_IDX].getMemDesc()->getPrecision();
+        selectedPd->setImplementationType(createKernel(tablePrc));
+    }
+    Node::createPrimitive();
 }
 
 void EmbeddingBagPackedSum::prepareParams() {
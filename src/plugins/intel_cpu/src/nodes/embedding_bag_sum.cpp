@@ -5,11 +5,13 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <type_traits>
 #include <dnnl_types.h>
 #include "ie_parallel.hpp"
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
 
 using namespace InferenceEngine;
 
@@ -46,64 +48,159 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
-template<typename T>
-void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
+impl_desc_type EmbeddingBagSum::createKernel(const InferenceEngine::Precision& tablePrc) {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (tablePrc == Precision::FP32 || tablePrc == Precision::BF16) {
+        kernel::EmbeddingBagCompileParams jcp;
+        jcp.src_data_type = tablePrc == Precision::BF16 ? element::bf16 : element::f32;
+        jcp.with_weights = _withWeights;
+
+        _jitKernel = kernel::JitKernel<kernel::EmbeddingBagCompileParams, kernel::EmbeddingBagCallArgs>::createInstance<kernel::EmbeddingBag>(jcp);
+        if (_jitKernel) {
+            using namespace dnnl::impl::cpu;
+            if (_jitKernel->getIsa() == x64::avx512_core) {
+                return jit_avx512;
+            } else if (_jitKernel->getIsa() == x64::avx2) {
+                return jit_avx2;
+            } else if (_jitKernel->getIsa() == x64::sse41) {
+                return jit_sse42;
+            }
+        }
+    }
+#endif // OPENVINO_ARCH_X86_64
+    return ref_any;
+}
+
+Precision EmbeddingBagSum::getOutputPrecision(const InferenceEngine::Precision& tablePrc) {
+    return tablePrc == Precision::BF16 ? Precision::FP32 : tablePrc;
+}
+
+void EmbeddingBagSum::prepareBags(size_t bagsNum) {
+    _bags.resize(bagsNum);
+
+    // The bags are collected in parallel by the equal chunks. The cost of a bag is the number of its reduced rows,
+    // every bag also costs one row for the output.
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    std::vector<size_t> chunkCost(nthr + 1lu, 0lu);
+    parallel_for(nthr, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(bagsNum, nthr, chunk, start, end);
+        size_t cost = 0lu;
+        for (size_t obi = start; obi < end; obi++) {
+            auto& bag = _bags[obi];
+            bag.withWeights = _withWeights;
+            getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+            bag.withWeights = bag.withWeights && _withWeights;
+            if (bag.indices == nullptr)
+                bag.size = 0lu;
+            cost += bag.size + 1lu;
+        }
+        chunkCost[chunk + 1lu] = cost;
+    });
+    for (size_t chunk = 0lu; chunk < nthr; chunk++) {
+        chunkCost[chunk + 1lu] += chunkCost[chunk];
+    }
+
+    // The pooling factors of the bags may differ a lot, so the bags are split between the threads by the cost:
+    // the thread starts from the first bag with the cost of the previous bags not less than its share.
+    const size_t totalCost = chunkCost[nthr];
+    _threadBagsStart.assign(nthr + 1lu, bagsNum);
+    _threadBagsStart[0] = 0lu;
+    parallel_for(nthr, [&](size_t chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(bagsNum, nthr, chunk, start, end);
+        size_t cost = chunkCost[chunk];
+        size_t ithr = 1lu;
+        // the shares up to the cost of the previous chunks start in the previous chunks
+        for (; ithr < nthr && totalCost * ithr / nthr <= cost; ithr++) {
+            if (chunk == 0lu)
+                _threadBagsStart[ithr] = 0lu;
+        }
+        for (size_t obi = start; obi < end; obi++) {
+            cost += _bags[obi].size + 1lu;
+            for (; ithr < nthr && totalCost * ithr / nthr <= cost; ithr++) {
+                _threadBagsStart[ithr] = obi + 1lu;
+            }
+        }
+    });
+}
+
+template<typename T, typename D>
+void EmbeddingBagSum::processData(const T* srcData, const D* weightsData,
                                   const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
-    initFromInputs();
+    auto *dstData = reinterpret_cast<D *>(outMemory->getData());
 
-    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
-    auto *dstData = reinterpret_cast<T *>(outMemory->getData());
-
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
+    // the kernel reduces the vectorized part of the rows, the rest columns are reduced below
+    size_t jitDepth = 0lu;
+#if defined(OPENVINO_ARCH_X86_64)
+    if (_jitKernel && std::is_same<D, float>::value) {
+        const size_t vecLen = _jitKernel->getVectorLen() / sizeof(float);
+        jitDepth = _embDepth - _embDepth % vecLen;
+    }
+#endif // OPENVINO_ARCH_X86_64
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+    parallel_for(_threadBagsStart.size() - 1lu, [&](size_t ithr) {
+        const size_t start = _threadBagsStart[ithr];
+        const size_t end = _threadBagsStart[ithr + 1];
 
         for (size_t obi = start; obi < end; obi++) {
             size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            const auto& bag = _bags[obi];
+            const int* indices = bag.indices;
+            const size_t indicesSize = bag.size;
+            const bool withWeights = bag.withWeights;
+            int weightsIdx = bag.weightsIdx;
 
             if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                    }
+                }
 
-                size_t inIdx = 0lu;
-                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+#if defined(OPENVINO_ARCH_X86_64)
+                if (jitDepth != 0lu) {
+                    kernel::EmbeddingBagCallArgs args;
+                    args.src_ptr = srcData;
+                    args.indices_ptr = indices;
+                    args.weights_ptr = withWeights ? reinterpret_cast<const float*>(weightsData + weightsIdx) : nullptr;
+                    args.dst_ptr = reinterpret_cast<float*>(dstData + dstIndex);
+                    args.indices_num = indicesSize;
+                    args.row_size = _embDepth * sizeof(T);
+                    args.work_amount = jitDepth;
+
+                    (*_jitKernel)(&args);
                 }
+#endif // OPENVINO_ARCH_X86_64
+                if (jitDepth == _embDepth)
+                    continue;
+
+                size_t inIdx = 0lu;
                 size_t srcIndex = indices[inIdx] * _embDepth;
 
                 if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
+                    for (size_t i = jitDepth; i < _embDepth; i++) {
                         dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
                     }
                     weightsIdx++;
                 } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
+                    for (size_t i = jitDepth; i < _embDepth; i++) {
                         dstData[dstIndex + i] = srcData[srcIndex + i];
                     }
                 }
 
                 for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
                     size_t srcIndex = indices[inIdx] * _embDepth;
 
                     if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
+                        for (size_t i = jitDepth; i < _embDepth; i++) {
                             dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
                         }
                         weightsIdx++;
                     } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
+                        for (size_t i = jitDepth; i < _embDepth; i++) {
                             dstData[dstIndex + i] += srcData[srcIndex + i];
                         }
                     }
@@ -114,18 +211,23 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                 }
             }
         }
-    };
-
-    parallel_nt(0, threadBody);
+    });
 }
 
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    initFromInputs();
+    prepareBags(outMemory->getShape().getStaticDims()[0]);
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), inDims, outMemory);
         }
+        case Precision::BF16: {
+            return processData(reinterpret_cast<const bfloat16_t*>(srcData),
+                    reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+        }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), inDims, outMemory);
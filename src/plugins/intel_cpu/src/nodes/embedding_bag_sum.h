@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "kernels/x64/embedding_bag.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -39,8 +40,14 @@ protected:
 
     void prepareParams(const VectorDims& indexStaticShape);
 
-    template<typename T>
-    void processData(const T* srcData, const T* weightsData,
+    // Creates the JIT kernel for the fp32 and bf16 tables and returns the implementation type.
+    impl_desc_type createKernel(const InferenceEngine::Precision& tablePrc);
+
+    // The output and the per sample weights precision, the bf16 table is accumulated in fp32.
+    static InferenceEngine::Precision getOutputPrecision(const InferenceEngine::Precision& tablePrc);
+
+    template<typename T, typename D>
+    void processData(const T* srcData, const D* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
@@ -51,6 +58,22 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+private:
+    struct Bag {
+        const int* indices = nullptr;
+        size_t size = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+
+    // Collects the indices of the output bags and splits the bags between the threads,
+    // so that the threads reduce about the same number of the table rows.
+    void prepareBags(size_t bagsNum);
+
+    std::vector<Bag> _bags;
+    std::vector<size_t> _threadBagsStart;
+    std::shared_ptr<kernel::JitKernelBase> _jitKernel;
 };
 
 }   // namespace node
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -51,11 +52,9 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -72,10 +71,19 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, Precision::I32});
+    const auto outPrecision = getOutputPrecision(inDataPrecision);
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, outPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outPrecision}}, impl_desc_type::ref_any);
+}
+
+void EmbeddingSegmentsSum::createPrimitive() {
+    if (auto selectedPd = getSelectedPrimitiveDescriptor()) {
+        const auto tablePrc = selectedPd->getConfig().inConfs[EMB_TABLE_IDX].getMemDesc()->getPrecision();
+        selectedPd->setImplementationType(createKernel(tablePrc));
+    }
+    Node::createPrimitive();
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
@@ -102,14 +110,14 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex, const int*& indices, size
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    // the segment ids are sorted, so the indices of the segment are contiguous
+    const auto segmentIdsEnd = segmentIds_ + indicesSize_;
+    const auto segment = std::equal_range(segmentIds_, segmentIdsEnd, static_cast<int>(embIndex));
+    size = static_cast<size_t>(segment.second - segment.first);
+    if (size != 0) {
+        const auto si = segment.first - segmentIds_;
+        indices = indices_ + si;
+        weightsIdx = static_cast<int>(si);
     }
 
     // Empty bag
@@ -310,11 +310,13 @@ void FullyConnected::prepackMLASWeight() {
             return _ptr;
         };
 
-        auto weightCache = context->getWeightsCache();
+        auto weightCache = context->getSharedWeightsCache();
         if (weightCache != nullptr) {
-            std::string format = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K);
-            const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
-                                            "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+            std::string format = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                 (weightsNonTransposed ? "F" : "T");
+            const std::string string_hash = WeightsSharing::contentKey(
+                WeightsSharing::describe(weightsMem->getDesc()) + "_" + format,
+                context->getWeightsHashes()->get(weightsMem), weightsMem->getSize());
 
             ptr = *weightCache->findOrCreate(string_hash, create);
         } else {
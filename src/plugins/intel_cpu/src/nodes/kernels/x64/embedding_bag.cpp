@@ -0,0 +1,177 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag.hpp"
+
+using namespace dnnl::impl::cpu;
+
+namespace ov {
+namespace intel_cpu {
+namespace kernel {
+
+#define GET_OFF(field) offsetof(EmbeddingBagCallArgs, field)
+
+template <x64::cpu_isa_t isa>
+EmbeddingBag<isa>::EmbeddingBag(const EmbeddingBagCompileParams& jcp) :
+        JitKernel(jit_name(), jcp, isa) {
+    if (m_jcp.src_data_type != element::f32 && m_jcp.src_data_type != element::bf16) {
+        OPENVINO_THROW("EmbeddingBag kernel does not support precision ", m_jcp.src_data_type);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void EmbeddingBag<isa>::generate() {
+    this->preamble();
+    registersPool = RegistersPool::create(isa, {rax, rcx, rsp, rdi, k0});
+
+    r64_src         = getReg64();
+    r64_indices     = getReg64();
+    r64_weights     = getReg64();
+    r64_dst         = getReg64();
+    r64_work_amount = getReg64();
+
+    mov(r64_src,         ptr[r64_params + GET_OFF(src_ptr)]);
+    mov(r64_indices,     ptr[r64_params + GET_OFF(indices_ptr)]);
+    mov(r64_weights,     ptr[r64_params + GET_OFF(weights_ptr)]);
+    mov(r64_dst,         ptr[r64_params + GET_OFF(dst_ptr)]);
+    mov(r64_work_amount, ptr[r64_params + GET_OFF(work_amount)]);
+
+    const auto simd = vlen / sizeof(float);
+    Xbyak::Label l_main_loop, l_main_end, l_tail_loop, l_end;
+
+    // The row is reduced by the blocks, so the accumulators stay in the registers for all the bag indices.
+    L(l_main_loop);
+    {
+        cmp(r64_work_amount, UNROLL * simd);
+        jl(l_main_end, T_NEAR);
+        reduceBlock(UNROLL);
+        jmp(l_main_loop, T_NEAR);
+    }
+    L(l_main_end);
+
+    L(l_tail_loop);
+    {
+        cmp(r64_work_amount, simd);
+        jl(l_end, T_NEAR);
+        reduceBlock(1lu);
+        jmp(l_tail_loop, T_NEAR);
+    }
+    L(l_end);
+
+    registersPool.reset();
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void EmbeddingBag<isa>::reduceBlock(size_t vectors) {
+    std::vector<RegistersPool::Reg<Vmm>> acc_regs;
+    std::vector<Vmm> v_acc;
+    for (size_t i = 0lu; i < vectors; i++) {
+        acc_regs.emplace_back(getVmm());
+        v_acc.push_back(acc_regs.back());
+        uni_vpxor(v_acc[i], v_acc[i], v_acc[i]);
+    }
+
+    if (m_jcp.with_weights) {
+        // the default index of the empty bag is not weighted
+        Xbyak::Label l_without_weights, l_end;
+        test(r64_weights, r64_weights);
+        jz(l_without_weights, T_NEAR);
+        reduceRows(v_acc, true);
+        jmp(l_end, T_NEAR);
+        L(l_without_weights);
+        reduceRows(v_acc, false);
+        L(l_end);
+    } else {
+        reduceRows(v_acc, false);
+    }
+
+    for (size_t i = 0lu; i < vectors; i++) {
+        uni_vmovups(ptr[r64_dst + i * vlen], v_acc[i]);
+    }
+
+    const auto elements = vectors * vlen / sizeof(float);
+    add(r64_src, elements * m_jcp.src_data_type.size());
+    add(r64_dst, vectors * vlen);
+    sub(r64_work_amount, elements);
+}
+
+template <x64::cpu_isa_t isa>
+void EmbeddingBag<isa>::reduceRows(const std::vector<Vmm>& v_acc, bool with_weights) {
+    constexpr size_t cache_line = 64lu;
+    const auto vector_bytes = vlen / sizeof(float) * m_jcp.src_data_type.size();
+    const auto block_bytes = v_acc.size() * vector_bytes;
+
+    auto r64_index_ptr = getReg64();
+    auto r64_count     = getReg64();
+    auto r64_row       = getReg64();
+    auto r64_prefetch  = getReg64();
+    auto v_row         = getVmm();
+    RegistersPool::Reg<Xbyak::Reg64> r64_weight_ptr;
+    RegistersPool::Reg<Vmm> v_weight;
+    if (with_weights) {
+        r64_weight_ptr = getReg64();
+        v_weight       = getVmm();
+        mov(r64_weight_ptr, r64_weights);
+    }
+
+    mov(r64_index_ptr, r64_indices);
+    mov(r64_count, ptr[r64_params + GET_OFF(indices_num)]);
+
+    Xbyak::Label l_loop;
+    L(l_loop);
+    {
+        // The rows are gathered from the random places of the big table, so the block of the row
+        // which will be reduced a few iterations later is requested in advance.
+        Xbyak::Label l_no_prefetch;
+        cmp(r64_count, PREFETCH_DISTANCE);
+        jle(l_no_prefetch, T_NEAR);
+        movsxd(r64_prefetch, dword[r64_index_ptr + PREFETCH_DISTANCE * sizeof(int)]);
+        imul(r64_prefetch, ptr[r64_params + GET_OFF(row_size)]);
+        add(r64_prefetch, r64_src);
+        for (size_t offset = 0lu; offset < block_bytes; offset += cache_line) {
+            prefetcht0(ptr[r64_prefetch + offset]);
+        }
+        L(l_no_prefetch);
+
+        movsxd(r64_row, dword[r64_index_ptr]);
+        imul(r64_row, ptr[r64_params + GET_OFF(row_size)]);
+        add(r64_row, r64_src);
+        if (with_weights) {
+            uni_vbroadcastss(v_weight, ptr[r64_weight_ptr]);
+            add(r64_weight_ptr, sizeof(float));
+        }
+        for (size_t i = 0lu; i < v_acc.size(); i++) {
+            loadRow(v_row, ptr[r64_row + i * vector_bytes]);
+            if (with_weights) {
+                uni_vfmadd231ps(v_acc[i], v_row, v_weight);
+            } else {
+                uni_vaddps(v_acc[i], v_acc[i], v_row);
+            }
+        }
+
+        add(r64_index_ptr, sizeof(int));
+        dec(r64_count);
+        jnz(l_loop, T_NEAR);
+    }
+}
+
+template <x64::cpu_isa_t isa>
+void EmbeddingBag<isa>::loadRow(const Vmm& v_dst, const Xbyak::Address& src_addr) {
+    if (m_jcp.src_data_type == element::bf16) {
+        // bf16 is the upper half of f32
+        uni_vpmovzxwd(v_dst, src_addr);
+        uni_vpslld(v_dst, v_dst, 16);
+    } else {
+        uni_vmovups(v_dst, src_addr);
+    }
+}
+
+template class EmbeddingBag<x64::avx512_core>;
+template class EmbeddingBag<x64::avx2>;
+template class EmbeddingBag<x64::sse41>;
+
+}   // namespace kernel
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_kernel_base.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+
+namespace ov {
+namespace intel_cpu {
+namespace kernel {
+
+struct EmbeddingBagCompileParams {
+    // f32 or bf16, the rows are accumulated in f32
+    element::Type src_data_type = element::f32;
+    bool with_weights = false;
+};
+
+struct EmbeddingBagCallArgs {
+    const void* src_ptr;        // the first reduced element of the embedding table
+    const int* indices_ptr;     // the indices of the bag, validated by the caller
+    const float* weights_ptr;   // the per sample weights of the bag or nullptr
+    float* dst_ptr;
+    uint64_t indices_num = 0lu;  // the number of the indices in the bag, must be non zero
+    uint64_t row_size = 0lu;     // the stride of the embedding table rows in bytes
+    uint64_t work_amount = 0lu;  // the number of the reduced elements of the row, must be a multiple of the vector length
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+class EmbeddingBag : public JitKernel<EmbeddingBagCompileParams, EmbeddingBagCallArgs> {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(EmbeddingBag)
+
+    explicit EmbeddingBag(const EmbeddingBagCompileParams& jcp);
+
+    void generate() override;
+
+    // the number of the table rows ahead of the reduced one to prefetch
+    static constexpr size_t PREFETCH_DISTANCE = 8lu;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::avx512_core, Xbyak::Zmm,
+                                                         isa == dnnl::impl::cpu::x64::sse41,       Xbyak::Xmm,
+                                                                                                   Xbyak::Ymm>::type;
+
+    // the number of the accumulators of the main loop
+    static constexpr size_t UNROLL = 4lu;
+
+    RegistersPool::Reg<Xbyak::Reg64> r64_src;
+    RegistersPool::Reg<Xbyak::Reg64> r64_indices;
+    RegistersPool::Reg<Xbyak::Reg64> r64_weights;
+    RegistersPool::Reg<Xbyak::Reg64> r64_dst;
+    RegistersPool::Reg<Xbyak::Reg64> r64_work_amount;
+
+    const Xbyak::Reg64 r64_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    // Reduces the block of `vectors` vectors of the bag rows starting from r64_src and stores it to r64_dst.
+    void reduceBlock(size_t vectors);
+
+    void reduceRows(const std::vector<Vmm>& v_acc, bool with_weights);
+
+    void loadRow(const Vmm& v_dst, const Xbyak::Address& src_addr);
+};
+
+}   // namespace kernel
+}   // namespace intel_cpu
+}   // namespace ov
+
+#endif // OPENVINO_ARCH_X86_64
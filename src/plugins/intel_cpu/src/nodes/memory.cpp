@@ -6,6 +6,7 @@
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
+#include "concat.h"
 #include "common/cpu_convert.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
@@ -21,6 +22,29 @@ namespace node {
 
 std::mutex MemoryNodeVirtualEdge::holderMutex;
 
+/**
+ * Copy data from one tensor into other.
+ * As is. Assume that data is dense tensor with same layout.
+ * @param dst destination memory object
+ * @param src source memory object
+ */
+inline
+static void simple_copy(const IMemory& dst, const IMemory& src) {
+    auto srcPtr = static_cast<uint8_t*>(src.getData());
+    auto dstPtr = static_cast<uint8_t*>(dst.getData());
+    if (src.getDataType() == dst.getDataType()) {
+        auto srcSizeInByte = src.getSize();
+        auto dstSizeInByte = dst.getSize();
+
+        IE_ASSERT(srcSizeInByte == dstSizeInByte) << "MemoryNode objects are not compatible. Has different sizes.";
+
+        cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
+    } else {
+        cpu_convert(srcPtr, dstPtr, src.getDesc().getPrecision(),
+            dst.getDesc().getPrecision(), src.getDesc().getShape().getElementsCount());
+    }
+}
+
 MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
     if (auto assignOp = std::dynamic_pointer_cast<ngraph::op::AssignBase>(op)) {
         _id = assignOp->get_variable_id();
@@ -31,11 +55,6 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -78,9 +97,85 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MemoryOutput::createPrimitive() {
+    auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
+    auto parentEdge = getParentEdgeAt(0);
+    if (isDynamicNode()) {
+        // The memory of the dynamic tensors is shared between the tensors with the disjoint lifetimes,
+        // so the producer never writes to the state directly. Instead, the growing state pattern
+        // Concat(ReadValue, new data) -> Assign is recognized, so just the new data is appended to the state.
+        auto concat = std::dynamic_pointer_cast<Concat>(parentEdge->getParent());
+        const auto& srcDesc = parentEdge->getMemory().getDesc();
+        appendToState = inputMemoryNode != nullptr && concat != nullptr &&
+                        concat->getParentEdgesAtPort(0)[0]->getParent().get() == inputNode &&
+                        srcDesc.hasLayoutType(LayoutType::ncsp) &&
+                        srcDesc.getPrecision() == inputMemoryNode->getBaseMemDescAtOutputPort(0)->getPrecision();
+        if (appendToState)
+            appendAxis = concat->getAxis();
+        return;
+    }
+
+    // The producer may write the new value directly into the state memory if nobody else uses its output
+    // (the same conditions as for the zero-copy graph outputs) and the memory layouts are the same
+    writeStateInPlace = inputMemoryNode != nullptr &&
+                        parentEdge->getMemory().getDesc().isCompatible(
+                            inputMemoryNode->getChildEdgeAt(0)->getMemory().getDesc());
+    if (!writeStateInPlace)
+        return;
+
+    void* defaultPtr = parentEdge->getMemory().getData();
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        // the state must not be shared with the ReadValue, as it reads the other buffer of the state
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace() ||
+            one_of(parent->getType(), Type::Input, Type::MemoryInput)) {
+            writeStateInPlace = false;
+            break;
+        }
+
+        for (auto& edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().getData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+}
+
+void MemoryOutput::assignState(const VariableStatePtr& newState) {
+    state = newState;
+    if (state && writeStateInPlace) {
+        auto stateMem = state->outputMem();
+        getParentEdgeAt(0)->getMemory().getMemoryMngr()->setExtBuff(stateMem->getData(), stateMem->getSize());
+    }
+}
+
+void MemoryOutput::commitState() {
+    if (state)
+        state->commit();
+}
+
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
+    if (state) {
+        if (appendToState && state->appendToInput(srcMemory, appendAxis))
+            return;
+        if (isDynamicNode())
+            state->redefineOutput(srcMemory.getStaticDims());
+        auto stateMem = state->outputMem();
+        // nothing to copy if the new value was written in place
+        if (stateMem->getData() != srcMemory.getData())
+            simple_copy(*stateMem, srcMemory);
+        return;
+    }
+
     auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
     inputMemoryNode->storeState(srcMemory);
@@ -88,11 +183,6 @@ void MemoryOutput::execute(dnnl::stream strm)  {
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -119,33 +209,50 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore = std::make_shared<Memory>(getEngine(), getChildEdgeAt(0)->getMemory().getDesc());
+    auto storeDesc = getBaseMemDescAtOutputPort(0);
+    // the dynamic state has the minimal shape until the ReadValue initializer or the user sets the value
+    if (!storeDesc->isDefined())
+        storeDesc = storeDesc->cloneWithNewDims(getOutputShapeAtPort(0).getMinDims(), true);
+    dataStore = std::make_shared<Memory>(getEngine(), storeDesc);
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->nullify();
-}
 
-/**
- * Copy data from one tensor into other.
- * As is. Assume that data is dense tensor with same layout.
- * @param dst destination memory object
- * @param src source memory object
- */
-inline
-static void simple_copy(const IMemory& dst, const IMemory& src) {
-    auto srcPtr = static_cast<uint8_t*>(src.getData());
-    auto dstPtr = static_cast<uint8_t*>(dst.getData());
-    if (src.getDataType() == dst.getDataType()) {
-        auto srcSizeInByte = src.getSize();
-        auto dstSizeInByte = dst.getSize();
+    // The consumers may read the state memory directly if they neither modify it nor place it elsewhere
+    // (the same conditions as for the zero-copy graph inputs)
+    readStateInPlace = true;
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
 
-        IE_ASSERT(srcSizeInByte == dstSizeInByte) << "MemoryNode objects are not compatible. Has different sizes.";
+        auto& child = ce->getChild();
+        if (child->isConstant() || ce->inPlace(Edge::LOOK_DOWN) || ce->modifiedInPlace() ||
+            child->getType() == Type::Output || (child->getType() == Type::Concatenation && child->isInPlace())) {
+            readStateInPlace = false;
+            break;
+        }
+    }
+}
 
-        cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
-    } else {
-        cpu_convert(srcPtr, dstPtr, src.getDesc().getPrecision(),
-            dst.getDesc().getPrecision(), src.getDesc().getShape().getElementsCount());
+void MemoryInput::assignState(const VariableStatePtr& newState) {
+    state = newState;
+    // the shape of the dynamic state is known only at the execution
+    if (state && readStateInPlace && !isDynamicNode()) {
+        auto stateMem = state->inputMem();
+        bindStateMemory(stateMem, stateMem->getSize());
+    }
+}
+
+void MemoryInput::bindStateMemory(const MemoryPtr& stateMem, size_t capacity) {
+    if (stateMem->getData() == nullptr)
+        return;
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+        ce->getMemory().getMemoryMngr()->setExtBuff(stateMem->getData(), capacity);
     }
 }
 
@@ -165,10 +272,34 @@ void MemoryInput::storeState(const IMemory &new_state) {
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    if (state) {
+        // the reset state takes the value of the initializer
+        if (state->isReset() && !getParentEdges().empty()) {
+            auto& initMemory = getParentEdgeAt(0)->getMemory();
+            if (isDynamicNode())
+                state->redefineInput(initMemory.getStaticDims());
+            simple_copy(*state->inputMem(), initMemory);
+        }
+        auto stateMem = state->inputMem();
+        if (isDynamicNode()) {
+            // the consumers may read the state memory within its capacity without reallocation
+            if (readStateInPlace)
+                bindStateMemory(stateMem, state->inputCapacity());
+            redefineOutputMemory({stateMem->getStaticDims()});
+        }
+        auto& dstMemory = getChildEdgeAt(0)->getMemory();
+        // nothing to copy if the consumers read the state in place
+        if (stateMem->getData() != dstMemory.getData())
+            simple_copy(dstMemory, *stateMem);
+        return;
+    }
+
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+
     // TODO: Should be simple call of:
     //           dst_mem.load(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *dataStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
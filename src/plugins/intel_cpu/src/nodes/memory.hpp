@@ -8,6 +8,7 @@
 #include <cpu_types.h>
 #include "ie_algorithm.hpp"
 #include "input.h"
+#include "memory_state.h"
 #include <node.h>
 #include <string>
 #include <memory>
@@ -27,6 +28,11 @@ class MemoryNode {
         return _id;
     }
     virtual void setInputNode(Node *) = 0;
+    /**
+     * @brief binds the node to the variable state of the infer request, the graph is shared between the requests
+     * so the state is assigned before each inference
+     */
+    virtual void assignState(const VariableStatePtr& state) = 0;
 };
 
 class MemoryOutput;
@@ -66,15 +72,27 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
+    bool needShapeInfer() const override {
+        return false;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
 
     void setInputNode(Node* node) override {
         inputNode = node;
     }
+    void assignState(const VariableStatePtr& newState) override;
+    // makes the value written by the inference the current value of the assigned state
+    void commitState();
 
  private:
     /**
@@ -82,6 +100,12 @@ public:
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    VariableStatePtr state;
+    // the producer writes directly into the state memory
+    bool writeStateInPlace = false;
+    // the new value is the concatenation of the current one with the new data, so only the new data is written
+    bool appendToState = false;
+    size_t appendAxis = 0;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -97,15 +121,24 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void assignState(const VariableStatePtr& newState) override;
     void storeState(const IMemory& mem);
     MemoryPtr getStore();
  private:
+    void bindStateMemory(const MemoryPtr& stateMem, size_t capacity);
+
     MemoryPtr dataStore;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    VariableStatePtr state;
+    // the consumers read directly from the state memory
+    bool readStateInPlace = false;
 };
 
 }   // namespace node
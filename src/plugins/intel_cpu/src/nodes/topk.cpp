@@ -14,6 +14,7 @@
 #include <ngraph/op/topk.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <algorithm>
+#include <cstring>
 
 #include <cpu/x64/jit_generator.hpp>
 #include <cpu/x64/jit_uni_eltwise.hpp>
@@ -1790,6 +1791,46 @@ private:
 };
 #endif
 
+namespace {
+
+// The keys of the radix select are unsigned integers with the same order as the values.
+template <typename T>
+inline uint32_t radix_key(T value);
+
+template <>
+inline uint32_t radix_key<float>(float value) {
+    // +0 and -0 are equal
+    if (value == 0.f)
+        value = 0.f;
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+template <>
+inline uint32_t radix_key<int32_t>(int32_t value) {
+    return static_cast<uint32_t>(value) ^ 0x80000000u;
+}
+
+// bf16 is stored as the raw bits, which are the upper half of f32
+template <>
+inline uint32_t radix_key<uint16_t>(uint16_t value) {
+    const uint32_t bits = value == 0x8000u ? 0u : static_cast<uint32_t>(value) << 16;
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+template <>
+inline uint32_t radix_key<int8_t>(int8_t value) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(value) ^ 0x80u);
+}
+
+template <>
+inline uint32_t radix_key<uint8_t>(uint8_t value) {
+    return value;
+}
+
+}   // namespace
+
 bool TopK::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(), ov::op::v1::TopK::get_type_info_static(),
@@ -1957,6 +1998,7 @@ void TopK::preset_params() {
     auto selectedPD = getSelectedPrimitiveDescriptor();
     auto data_type = DnnlExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision());
     data_size = DnnlExtensionUtils::sizeOfDataType(data_type);
+    data_precision = selectedPD->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision();
 
     topk_innermost = (layout == TopKLayoutType::topk_ncsp && axis == static_cast<int>(getOutputShapeAtPort(TOPK_DATA).getRank() - 1)) ||
                     ((layout == TopKLayoutType::topk_nspc || layout == TopKLayoutType::topk_blocked) && axis == 1);
@@ -2028,6 +2070,18 @@ void TopK::prepareParams() {
         //           where, N = axis_dim, K = topk_k
         //           the above two alg_costs are not the exact implementation costs, yet it's proper to use them to decide
         //           which algorithm should be used for specific N and K.
+        // [case 5]: if topk is imposed on innermost dimension of planar(ncsp/nspc) layout with long axis and not small top_k,
+        //           radix select is used for both static and dynamic shapes instead of the jit kernel. It finds the K-th
+        //           element in a few linear passes and sorts only the K selected elements, alg_cost_radix ~ 2N + K * logK,
+        //           while heap sort and bubble sort cost N * logK and N * K. The result is stable, so stable sorting is
+        //           supported as well.
+        const size_t radix_select_min_axis_dim = 1024;
+        const size_t radix_select_min_top_k = 16;
+        // the constant top_k of the static shape is not clamped, and shape inference allows top_k > axis_dim
+        radix_select = (layout == TopKLayoutType::topk_ncsp || layout == TopKLayoutType::topk_nspc) && topk_innermost &&
+                       axis_dim >= radix_select_min_axis_dim && static_cast<size_t>(top_k) >= radix_select_min_top_k &&
+                       static_cast<size_t>(top_k) <= axis_dim;
+
         if (!isDynamicNode()) {
             const size_t count_xmm = 16; // only 16 vector registers are valid in sse instructions even for avx512_core
             if (static_cast<size_t>(top_k) <= count_xmm / 2 - 2) {
@@ -2051,7 +2105,8 @@ void TopK::prepareParams() {
             }
         }
 
-        prepare_original_idx();
+        if (!radix_select)
+            prepare_original_idx();
     } else { //reference mode
         int j;
         for (j = src_dims.size() - 1; j >= 0; j--) {
@@ -2085,6 +2140,10 @@ void TopK::createPrimitive() {
             preset_params_done = true;
         }
 
+        // the static shape sorted by radix select doesn't need the jit kernel
+        if (radix_select && !isDynamicNode())
+            return;
+
         // Shape related config params will only be used for static shape sorting algorithms.
         // Such params are useless for dynamic shapes, instead their jit_topk_call_args counterparts
         // will be used. These params are: top_k, axis_dim, sort_stride, work_amount
@@ -2160,6 +2219,11 @@ void TopK::execute(dnnl::stream strm) {
 }
 
 void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    if (radix_select) {
+        topk_radix_select(in_ptr, out_ptr, out_idx_ptr);
+        return;
+    }
+
     uint8_t *process_ptr = vec_process_ptr.data();
     uint8_t *process_idx_ptr = vec_process_idx_ptr.data();
 
@@ -2369,6 +2433,110 @@ void TopK::calc_dims_size(const VectorDims &layout_dims) {
     }
 }
 
+void TopK::topk_radix_select(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    auto out_idx = reinterpret_cast<int32_t *>(out_idx_ptr);
+    switch (data_precision) {
+        case Precision::FP32:
+            topk_radix_select_process(reinterpret_cast<const float *>(in_ptr), reinterpret_cast<float *>(out_ptr), out_idx);
+            break;
+        case Precision::BF16:
+            topk_radix_select_process(reinterpret_cast<const uint16_t *>(in_ptr), reinterpret_cast<uint16_t *>(out_ptr), out_idx);
+            break;
+        case Precision::I32:
+            topk_radix_select_process(reinterpret_cast<const int32_t *>(in_ptr), reinterpret_cast<int32_t *>(out_ptr), out_idx);
+            break;
+        case Precision::I8:
+            topk_radix_select_process(reinterpret_cast<const int8_t *>(in_ptr), reinterpret_cast<int8_t *>(out_ptr), out_idx);
+            break;
+        case Precision::U8:
+            topk_radix_select_process(reinterpret_cast<const uint8_t *>(in_ptr), reinterpret_cast<uint8_t *>(out_ptr), out_idx);
+            break;
+        default:
+            IE_THROW() << errorPrefix << " gets unsupported precision for radix select: " << data_precision;
+    }
+}
+
+// The topk axis is innermost and dense, so the rows are contiguous in both source and destination.
+// The K-th element is found by the radix select over the 8-bit digits of the keys, starting from the most
+// significant one: each pass builds the histogram of the digit among the elements matching the found prefix.
+// The elements above the threshold and the first elements equal to it are then taken in the index order,
+// so the ties are resolved by the smaller index like in the stable sorting.
+template <typename T>
+void TopK::topk_radix_select_process(const T *in_ptr, T *out_ptr, int32_t *out_idx_ptr) {
+    const size_t K = static_cast<size_t>(top_k);
+    // the smallest values become the largest keys in min mode
+    const uint32_t key_xor = mode_max ? 0u : 0xFFFFFFFFu;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(O, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        // the buffers are allocated once per thread and reused by all its rows
+        std::vector<uint32_t> keys(A);
+        std::vector<uint32_t> candidates(A);
+        std::vector<int32_t> selected(K);
+        for (size_t o = start; o < end; o++) {
+            const T *src = in_ptr + o * A;
+            for (size_t a = 0; a < A; a++) {
+                keys[a] = radix_key<T>(src[a]) ^ key_xor;
+            }
+
+            const uint32_t *cand = keys.data();
+            size_t cand_num = A;
+            uint32_t threshold = 0;
+            size_t k_left = K;    // the number of the elements with the found prefix to take
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                size_t hist[256] = {0};
+                for (size_t c = 0; c < cand_num; c++) {
+                    hist[(cand[c] >> shift) & 0xFF]++;
+                }
+                uint32_t digit = 0xFF;
+                while (hist[digit] < k_left) {
+                    k_left -= hist[digit];
+                    digit--;
+                }
+                threshold |= digit << shift;
+                if (shift == 0)
+                    break;
+
+                // keep only the elements matching the prefix for the next digit, they are compacted in place after the first pass
+                const uint32_t prefix_mask = 0xFFFFFFFFu << shift;
+                size_t next_num = 0;
+                for (size_t c = 0; c < cand_num; c++) {
+                    if ((cand[c] & prefix_mask) == threshold)
+                        candidates[next_num++] = cand[c];
+                }
+                cand = candidates.data();
+                cand_num = next_num;
+            }
+
+            size_t taken = 0;
+            for (size_t a = 0; a < A && taken < K; a++) {
+                if (keys[a] > threshold) {
+                    selected[taken++] = static_cast<int32_t>(a);
+                } else if (keys[a] == threshold && k_left > 0) {
+                    selected[taken++] = static_cast<int32_t>(a);
+                    k_left--;
+                }
+            }
+
+            if (!sort_index) {
+                std::sort(selected.begin(), selected.end(), [&](int32_t l, int32_t r) {
+                    return keys[l] > keys[r] || (keys[l] == keys[r] && l < r);
+                });
+            }
+
+            T *dst = out_ptr + o * K;
+            int32_t *dst_idx = out_idx_ptr + o * K;
+            for (size_t k = 0; k < K; k++) {
+                dst[k] = src[selected[k]];
+                dst_idx[k] = selected[k];
+            }
+        }
+    });
+}
+
 void TopK::topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx) {
     if (mode_max)
         topk_ref_process(in_ptr, out_ptr, dst_idx, src_dims, [](float x, float y)->float { return x > y; });
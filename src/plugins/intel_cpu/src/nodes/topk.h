@@ -101,6 +101,9 @@ public:
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
+    void topk_radix_select(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr);
+    template <typename T>
+    void topk_radix_select_process(const T *in_ptr, T *out_ptr, int32_t *out_idx_ptr);
     inline void topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *src_idx,
                                     uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount);
     inline static int count(const VectorDims& dims, size_t start_ind, size_t end_ind);
@@ -129,11 +132,13 @@ private:
     int top_k = 0;
     int dim = 0, before_num = 0;
     bool bubble_inplace = false;
+    bool radix_select = false;
     bool preset_params_done = false;
 
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
     TopKAlgorithm algorithm = TopKAlgorithm::topk_bubble_sort;
+    InferenceEngine::Precision data_precision;
 
     std::vector<int> vec_bitonic_idx;
     std::vector<int> vec_bitonic_k_idx;
@@ -5,6 +5,9 @@
 #include "unique.hpp"
 
 #include "ie_parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <openvino/op/unique.hpp>
 #include "common/cpu_memcpy.h"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
@@ -162,102 +165,188 @@ void Unique::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+namespace {
+
 template <typename T>
-void Unique::flattenTensorExec() {
-    const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->getData());
-    const size_t inputLen = getParentEdgeAt(IN_DATA)->getMemoryPtr()->getSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
+inline uint64_t hashValue(T value) {
+    return static_cast<uint64_t>(value);
+}
+
+template <>
+inline uint64_t hashValue<float>(float value) {
+    // +0 and -0 are equal, so they must get the same hash
+    if (value == 0.f) {
+        value = 0.f;
     }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Splits [0, n) into the blocks of the parallel scans, so that the result does not depend on the number of threads.
+inline size_t scanBlocksNum(size_t n) {
+    constexpr size_t minBlockSize = 4096lu;
+    return std::max(std::min(static_cast<size_t>(parallel_get_max_threads()), n / minBlockSize), static_cast<size_t>(1lu));
+}
+
+// Sorts the chunks in parallel and merges the pairs of the sorted chunks in parallel rounds.
+template <typename E, typename Compare>
+void parallelSort(std::vector<E>& data, const Compare& cmp) {
+    const size_t n = data.size();
+    const size_t chunksNum = scanBlocksNum(n);
+    if (chunksNum == 1lu) {
+        std::sort(data.begin(), data.end(), cmp);
+        return;
+    }
+
+    std::vector<size_t> bounds(chunksNum + 1lu);
+    for (size_t c = 0lu; c <= chunksNum; c++) {
+        bounds[c] = n * c / chunksNum;
+    }
+    parallel_for(chunksNum, [&](size_t c) {
+        std::sort(data.begin() + bounds[c], data.begin() + bounds[c + 1], cmp);
+    });
+
+    std::vector<E> buffer(n);
+    auto* src = &data;
+    auto* dst = &buffer;
+    while (bounds.size() > 2lu) {
+        const size_t runs = bounds.size() - 1lu;
+        parallel_for((runs + 1lu) / 2lu, [&](size_t p) {
+            const auto first = bounds[2 * p];
+            const auto middle = bounds[std::min(2 * p + 1, runs)];
+            const auto last = bounds[std::min(2 * p + 2, runs)];
+            std::merge(src->begin() + first, src->begin() + middle,
+                       src->begin() + middle, src->begin() + last,
+                       dst->begin() + first, cmp);
+        });
+        std::vector<size_t> merged;
+        for (size_t r = 0lu; r < runs; r += 2lu) {
+            merged.push_back(bounds[r]);
+        }
+        merged.push_back(n);
+        bounds.swap(merged);
+        std::swap(src, dst);
     }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
+    if (src != &data) {
+        data.swap(buffer);
     }
-    uniqueLen = inputLen;
+}
 
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
+}   // namespace
 
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
+template <typename T>
+void Unique::flattenTensorExec() {
+    const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->getData());
+    const size_t inputLen = getParentEdgeAt(IN_DATA)->getMemoryPtr()->getSize() / sizeof(T);
+    std::vector<T> uniDataTmp(inputLen);
+    auto uniDataTmpPtr = uniDataTmp.data();
+    int *firstTmpPtr = firstUniTmp.data(), *inToOutTmpPtr = inToOutTmp.data(), *occurTmpPtr = occurTmp.data();
+
+    // The concurrent open addressing hash table. The slot keeps the smallest input index of its value,
+    // so the key is compared through the input data and the slot is filled by a single CAS.
+    constexpr int32_t emptySlot = -1;
+    size_t capacity = 1lu;
+    while (capacity < 2lu * inputLen) {
+        capacity <<= 1;
+    }
+    int capacityLog = 0;
+    while ((1lu << capacityLog) < capacity) {
+        capacityLog++;
+    }
+    const size_t mask = capacity - 1lu;
+    std::vector<std::atomic<int32_t>> slots(capacity);
+    std::vector<std::atomic<int32_t>> slotCounts(capacity);
+    std::vector<int32_t> slotRanks(capacity);
+    std::vector<int32_t> slotOf(inputLen);
+    parallel_for(capacity, [&](size_t s) {
+        slots[s].store(emptySlot, std::memory_order_relaxed);
+        slotCounts[s].store(0, std::memory_order_relaxed);
+    });
+
+    parallel_for(inputLen, [&](size_t i) {
+        const T value = srcDataPtr[i];
+        const auto idx = static_cast<int32_t>(i);
+        // Fibonacci hashing spreads the consecutive values over the table
+        size_t pos = capacityLog == 0 ? 0lu : static_cast<size_t>((hashValue(value) * 0x9E3779B97F4A7C15ull) >> (64 - capacityLog));
+        while (true) {
+            int32_t cur = slots[pos].load(std::memory_order_acquire);
+            if (cur == emptySlot && slots[pos].compare_exchange_strong(cur, idx, std::memory_order_acq_rel)) {
+                break;
             }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
+            if (srcDataPtr[cur] == value) {
+                while (idx < cur && !slots[pos].compare_exchange_weak(cur, idx, std::memory_order_acq_rel)) {}
+                break;
             }
+            pos = (pos + 1lu) & mask;
         }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
+        slotCounts[pos].fetch_add(1, std::memory_order_relaxed);
+        slotOf[i] = static_cast<int32_t>(pos);
+    });
+
+    // The unique values are numbered in the order of their first occurrence by the parallel prefix sum.
+    auto isFirst = [&](size_t i) {
+        return slots[slotOf[i]].load(std::memory_order_relaxed) == static_cast<int32_t>(i);
+    };
+    const size_t blocksNum = scanBlocksNum(inputLen);
+    std::vector<size_t> blockOffsets(blocksNum + 1lu, 0lu);
+    parallel_for(blocksNum, [&](size_t b) {
+        size_t count = 0lu;
+        for (size_t i = inputLen * b / blocksNum; i < inputLen * (b + 1) / blocksNum; i++) {
+            count += isFirst(i);
         }
-    } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
+        blockOffsets[b + 1] = count;
+    });
+    for (size_t b = 0lu; b < blocksNum; b++) {
+        blockOffsets[b + 1] += blockOffsets[b];
+    }
+    uniqueLen = blockOffsets[blocksNum];
+
+    parallel_for(blocksNum, [&](size_t b) {
+        auto rank = blockOffsets[b];
+        for (size_t i = inputLen * b / blocksNum; i < inputLen * (b + 1) / blocksNum; i++) {
+            if (isFirst(i)) {
+                const auto pos = slotOf[i];
+                slotRanks[pos] = static_cast<int32_t>(rank);
+                uniDataTmpPtr[rank] = srcDataPtr[i];
+                firstTmpPtr[rank] = static_cast<int32_t>(i);
+                occurTmpPtr[rank] = slotCounts[pos].load(std::memory_order_relaxed);
+                rank++;
+            }
         }
+    });
+    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
+        parallel_for(inputLen, [&](size_t i) {
+            inToOutTmpPtr[i] = slotRanks[slotOf[i]];
+        });
+    }
+
+    if (sorted) {
+        // Only the unique values are sorted, the order of the first occurrence gives the permutation.
+        struct OrdEl {
+            T val;
+            int32_t idx;
+        };
+        std::vector<OrdEl> uniqueEls(uniqueLen);
+        parallel_for(uniqueLen, [&](size_t u) {
+            uniqueEls[u] = { uniDataTmpPtr[u], static_cast<int32_t>(u) };
+        });
+        parallelSort(uniqueEls, [](const OrdEl& el1, const OrdEl& el2) { return el1.val < el2.val; });
+
+        std::vector<int32_t> firstSorted(uniqueLen), occurSorted(uniqueLen), sortedPos(uniqueLen);
+        parallel_for(uniqueLen, [&](size_t u) {
+            const auto idx = uniqueEls[u].idx;
+            uniDataTmpPtr[u] = uniqueEls[u].val;
+            firstSorted[u] = firstTmpPtr[idx];
+            occurSorted[u] = occurTmpPtr[idx];
+            sortedPos[idx] = static_cast<int32_t>(u);
+        });
+        cpu_parallel_memcpy(firstTmpPtr, firstSorted.data(), uniqueLen * sizeof(int32_t));
+        cpu_parallel_memcpy(occurTmpPtr, occurSorted.data(), uniqueLen * sizeof(int32_t));
         if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-        uniqueLen = 1;
-
-        for (size_t i = 1; i < inputLen; i++) {
-            bool found = false;
-            size_t j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
-            }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
-            }
+            parallel_for(inputLen, [&](size_t i) {
+                inToOutTmpPtr[i] = sortedPos[inToOutTmpPtr[i]];
+            });
         }
     }
 
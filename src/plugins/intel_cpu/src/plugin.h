@@ -57,6 +57,9 @@ private:
 
     Config engConfig;
     ExtensionManager::Ptr extensionManager = std::make_shared<ExtensionManager>();
+    // the packed weights caches shared by all the compiled models of the plugin instance,
+    // so the variants of the same model compiled by one Core reuse the weights
+    std::shared_ptr<SocketsWeights> sharedWeights = std::make_shared<SocketsWeights>();
     /* Explicily configured streams have higher priority than performance hints.
        So track if streams is set explicitly (not auto-configured) */
     bool streamsExplicitlySetForEngine = false;
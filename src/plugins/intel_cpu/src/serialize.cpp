@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/shared_buffer.hpp>
 
 #include <pugixml.hpp>
 
@@ -59,6 +60,37 @@ namespace {
             info_iter->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // Constants section of the blob starts on this alignment, so it can be referenced directly from a memory mapping
+    constexpr size_t constsAlignment = 64;
+
+    IE_SUPPRESS_DEPRECATED_START
+    /*
+     * @brief Allocator which shares the memory of a stream buffer (e.g. a memory mapped compiled blob)
+     * and keeps it alive while the blob is in use
+     */
+    class SharedBufferAllocator final : public InferenceEngine::IAllocator {
+    public:
+        SharedBufferAllocator(std::shared_ptr<ov::AlignedBuffer> buffer, size_t offset, size_t size)
+            : _buffer(std::move(buffer)), _data(_buffer->get_ptr<char>() + offset), _size(size) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle == _data ? handle : nullptr;
+        }
+        void unlock(void*) noexcept override {}
+        void* alloc(size_t size) noexcept override {
+            return size <= _size ? _data : nullptr;
+        }
+        bool free(void*) noexcept override {
+            return false;
+        }
+
+    private:
+        std::shared_ptr<ov::AlignedBuffer> _buffer;
+        void* _data;
+        size_t _size;
+    };
+    IE_SUPPRESS_DEPRECATED_END
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -110,6 +142,12 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
         }
 
         xml_doc.save(stream);
+
+        // pad the custom data with zeros so the constants section which follows it is aligned
+        const auto pos = static_cast<size_t>(stream.tellp());
+        const auto padding = (constsAlignment - pos % constsAlignment) % constsAlignment;
+        for (size_t i = 0; i < padding; ++i)
+            stream.put('\0');
     };
 
     // Serialize to old representation in case of old API
@@ -146,10 +184,24 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const InferenceEngine::TensorDesc constsDesc(InferenceEngine::Precision::U8,
+                                                     {hdr.consts_size},
+                                                     InferenceEngine::Layout::C);
+        // the stream is backed by a memory buffer (e.g. the cache entry is memory mapped),
+        // so the constants are referenced in place instead of being copied
+        auto sharedBuffer = dynamic_cast<ov::SharedStreamBuffer*>(_istream.rdbuf());
+        const bool sharedConsts = sharedBuffer && sharedBuffer->get_buffer() &&
+                                  hdr.consts_offset + hdr.consts_size <= sharedBuffer->get_buffer()->size();
+        if (sharedConsts) {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                constsDesc,
+                std::make_shared<SharedBufferAllocator>(sharedBuffer->get_buffer(), hdr.consts_offset, hdr.consts_size));
+            dataBlob->allocate();
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(constsDesc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -4,14 +4,33 @@
 
 #include "weights_cache.hpp"
 
+#include <algorithm>
+#include <common/memory_desc_wrapper.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #include <ie_system_conf.h>
 #include <memory>
+#include <openvino/runtime/compute_hash.hpp>
 
 namespace ov {
 namespace intel_cpu {
 
+constexpr size_t WeightsSharing::kMinPurgeThreshold;
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+uint64_t WeightsHashes::get(const MemoryCPtr& memory) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = hashes.find(memory.get());
+        if (found != hashes.end() && !found->second.memory.expired())
+            return found->second.hash;
+    }
+    // the graphs of the streams may hash the same constant concurrently, the results are the same
+    const uint64_t hash = ov::runtime::compute_hash(memory->getData(), memory->getSize());
+    std::lock_guard<std::mutex> lock(guard);
+    hashes[memory.get()] = HashInfo{memory, hash};
+    return hash;
+}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -48,6 +67,8 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
             newPtr = create();
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
+            if (sharedWeights.size() >= purgeThreshold)
+                purgeExpired();
         }
     }
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
@@ -55,6 +76,25 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+std::string WeightsSharing::describe(const MemoryDesc& desc) {
+    std::string description = std::string(desc.getPrecision().name()) + "_" + desc.getShape().toString() + "_" +
+                              desc.serializeFormat() + "_" + std::to_string(desc.getCurrentMemSize());
+    if (desc.getType() & MemoryDescType::Dnnl) {
+        // the format doesn't show the padding and the extra data (e.g. the compensation of the int8 weights),
+        // which change the content of the converted weights, so the whole oneDNN descriptor is taken
+        const auto& md = *desc.as<const DnnlMemoryDesc>()->getDnnlDesc().get();
+        const auto extra = dnnl::impl::memory_desc_wrapper(&md).extra();
+        description += "_" + std::to_string(extra.flags) + "_" + std::to_string(extra.compensation_mask) + "_" +
+                       std::to_string(extra.scale_adjust) + "_" +
+                       std::to_string(dnnl::impl::primitive_hashing::get_md_hash(md));
+    }
+    return description;
+}
+
+std::string WeightsSharing::contentKey(const std::string& layout, uint64_t dataHash, size_t size) {
+    return layout + "_" + std::to_string(size) + "_" + std::to_string(dataHash);
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -71,6 +111,17 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+void WeightsSharing::purgeExpired() {
+    for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+        if (!it->second || it->second->sharedMemory.expired())
+            it = sharedWeights.erase(it);
+        else
+            ++it;
+    }
+    // the purge is amortized over the insertions
+    purgeThreshold = std::max(kMinPurgeThreshold, 2 * sharedWeights.size());
+}
+
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++)
@@ -47,10 +47,40 @@ protected:
     uint64_t table[kTableSize];
 };
 
+/**
+ * Content hashes of the constant data of a compiled model
+ * The hash of each constant is computed once, the nodes of all the stream graphs reuse it
+ * to build the content based keys of the packed weights
+ *
+ * The memory objects are referenced weakly, so the hash of a released object is never
+ * taken for a new one allocated at the same address
+ *
+ * Is a thread safe
+ */
+class WeightsHashes {
+public:
+    typedef std::shared_ptr<WeightsHashes> Ptr;
+
+    // Returns the XXH64 based content hash of the memory data, computes it on the first request
+    uint64_t get(const MemoryCPtr& memory);
+
+private:
+    struct HashInfo {
+        std::weak_ptr<const IMemory> memory;
+        uint64_t hash;
+    };
+
+    std::mutex guard;
+    std::unordered_map<const IMemory*, HashInfo> hashes;
+};
+
 /**
  * Caching store of Memory objects
  * Will return a cached object or create new one
  *
+ * The store doesn't own the memory objects: an object is alive as long as
+ * one of the graphs uses it, and the expired entries are dropped from time to time.
+ *
  * Is a thread safe
  */
 class WeightsSharing {
@@ -96,9 +126,24 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    // Describes the memory layout for the content based keys: the precision, the dims, the format and the byte size,
+    // plus the extra data and the hash of the full descriptor for the oneDNN descriptors
+    static std::string describe(const MemoryDesc& desc);
+
+    // Builds the key of the data converted to the layout from the content hash and the byte size of the data,
+    // which don't depend on the node names and the data location, so the equal weights of the different
+    // compiled models converted to the same layout share the memory
+    static std::string contentKey(const std::string& layout, uint64_t dataHash, size_t size);
+
 protected:
+    // drops the entries of the released memory objects, should be called under the guard
+    void purgeExpired();
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    // the store size which triggers the next purge of the expired entries
+    size_t purgeThreshold = kMinPurgeThreshold;
+    static constexpr size_t kMinPurgeThreshold = 64;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -76,6 +76,9 @@ public:
 
         selectedType = makeSelectedTypeStr("ref", inType);
         targetDevice = ov::test::utils::DEVICE_CPU;
+        if (inType == ElementType::bf16) {
+            rel_threshold = 1e-2;
+        }
 
         init_input_shapes({ inputShapes });
 
@@ -163,5 +166,36 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(ov::test::utils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+// The pooling factors of the bags differ a lot, so the threads get different numbers of the bags.
+// The depth of the rows is not a multiple of the vector length to cover both the kernel and the tail.
+const std::vector<InputShape> input_shapes_skewed = {
+        {{10, 35}, {{10, 35}}},
+        {{10, 8, 9}, {{10, 8, 9}}},
+};
+
+const std::vector<std::vector<size_t>> indices_skewed = {
+        {0, 9, 1, 8, 2, 7, 3, 6, 4, 5, 5, 4, 6, 3, 7, 2, 8, 1, 9, 0,
+         1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 0, 0}};
+const std::vector<std::vector<size_t>> offsets_skewed = {{0, 1, 1, 37, 38, 38, 38, 39}};
+
+const std::vector<ElementType> netPrecisions_skewed = {
+        ElementType::f32,
+        ElementType::bf16
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_skewed, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(input_shapes_skewed),
+                        ::testing::ValuesIn(indices_skewed),
+                        ::testing::ValuesIn(offsets_skewed),
+                        ::testing::Values(3),
+                        ::testing::ValuesIn(with_weights),
+                        ::testing::ValuesIn(with_default_index)),
+                ::testing::ValuesIn(netPrecisions_skewed),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(ov::test::utils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+
 #include <common_test_utils/ov_tensor_utils.hpp>
 #include "test_utils/cpu_test_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
@@ -204,6 +206,10 @@ protected:
                     }
                 }
             }
+        } else if (netPrecision == ElementType::i8 || netPrecision == ElementType::u8) {
+            // the values repeat, the ties are resolved by the smaller index in both the plugin and the reference
+            const int32_t start_from = netPrecision == ElementType::i8 ? -128 : 0;
+            tensor = ov::test::utils::create_and_fill_tensor(funcInputs[0].get_element_type(), shape, 255, start_from);
         } else {
             FAIL() << "generate_inputs for " << netPrecision << " precision isn't supported";
         }
@@ -427,6 +433,132 @@ INSTANTIATE_TEST_CASE_P(smoke_Top1_dynamic, TopKLayerCPUTest,
         ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+// the long innermost axis with not small k is sorted by radix select
+const std::vector<int64_t> k_radix_select = {16, 200};
+
+std::vector<ov::test::InputShape> inputShapes_radix_select_ncsp = {
+    {{}, {{2, 3, 2, 1500}}},
+};
+
+std::vector<ov::test::InputShape> inputShapes_radix_select_nspc = {
+    {{}, {{2, 1500, 3, 2}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_radix_select = {
+    {{2, 3, 2, {1000, 2000}}, {{2, 3, 2, 1500}, {2, 3, 2, 2000}}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_ncsp, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix_select),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select_ncsp)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_ncsp_bf16, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix_select),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select_ncsp)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[1])),
+    TopKLayerCPUTest::getTestCaseName);
+
+const std::vector<ElementType> netPrecisions_radix_select_int = {
+    ElementType::i32,
+    ElementType::i8,
+    ElementType::u8
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_ncsp_int, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix_select),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions_radix_select_int),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select_ncsp)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_nspc, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix_select),
+            ::testing::Values(1),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select_nspc)),
+        ::testing::Values(CPUSpecificParams({nhwc, x}, {nhwc, nhwc}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_dynamic, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::Values(1),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapesDynamic_radix_select)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+// Benchmark of the radix select over the K x N grid, run with --gtest_also_run_disabled_tests
+TEST(TopKRadixSelectBenchmark, DISABLED_infer) {
+    constexpr size_t rows = 256;
+    constexpr size_t iterations = 20;
+    ov::Core core;
+    for (const int64_t axis_dim : {1024, 8192, 65536}) {
+        for (const int64_t keep_k : {16, 64, 256}) {
+            const ov::Shape shape{rows, static_cast<size_t>(axis_dim)};
+            auto param = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, shape);
+            auto k = ov::op::v0::Constant::create(ElementType::i64, ov::Shape{}, {keep_k});
+            auto topk = std::make_shared<ov::op::v11::TopK>(param, k, 1, SortMode::MAX, SortType::SORT_VALUES,
+                                                            ElementType::i32);
+            auto model = std::make_shared<ov::Model>(topk->outputs(), ov::ParameterVector{param}, "TopK");
+
+            auto request = core.compile_model(model, ov::test::utils::DEVICE_CPU).create_infer_request();
+            request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ElementType::f32, shape, 1000, -500));
+            // the first inference is not measured, it allocates the memory
+            request.infer();
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+                request.infer();
+            const auto time =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "N=" << axis_dim << " K=" << keep_k << ": " << time / iterations << " ms, "
+                      << rows * axis_dim * iterations / time / 1e3 << " M elements/s" << std::endl;
+        }
+    }
+}
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
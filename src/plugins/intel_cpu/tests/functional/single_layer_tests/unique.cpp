@@ -171,6 +171,7 @@ std::vector<std::vector<InputShape>> statShapes1D = {
         {{{}, {{32}}}},    // Static shapes
         {{{}, {{64}}}},    // Static shapes
         {{{}, {{99}}}},    // Static shapes
+        {{{}, {{10000}}}}, // Static shapes
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_static_1D, UniqueLayerTestCPU,
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+/*This test compiles two variants of the model with the same weights:
+
+       Param   Constant
+          \     /
+          MatMul
+            |
+          Output
+
+  The variants differ by the batch size only, so the weights packed for the second compiled model
+  are found by their content in the plugin store and the memory is not allocated again.
+  A single stream is used, so the sharing doesn't depend on the number of streams.
+*/
+
+namespace SubgraphTestsDefinitions {
+
+#ifndef __APPLE__  // TODO: add getVmRSSInKB() for Apple platform
+
+class SharedPackedWeights : public ::testing::Test, public CPUTestsBase {
+public:
+    static constexpr size_t channels = 2048;
+
+    std::shared_ptr<ov::Model> makeModel(size_t batch) {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{batch, channels});
+        // the transposed weights are used as is, so the compiled models refer to the same constant data
+        auto matmul = std::make_shared<ov::opset8::MatMul>(param, weights, false, true);
+        auto result = std::make_shared<ov::opset8::Result>(matmul);
+        return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                           ov::ParameterVector{param},
+                                           "SharedPackedWeights");
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<float> values(channels * channels);
+        for (size_t i = 0; i < values.size(); i++)
+            values[i] = static_cast<float>(i % 7) / 7.0f;
+        weights = ov::opset8::Constant::create(ov::element::f32, {channels, channels}, values);
+        weightsSizeKB = channels * channels * sizeof(float) / 1024;
+    }
+
+    std::shared_ptr<ov::opset8::Constant> weights;
+    size_t weightsSizeKB = 0;
+};
+
+TEST_F(SharedPackedWeights, smoke_CompiledModelsShareWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto test = [&]() {
+        ov::Core core;
+        const ov::AnyMap config = {ov::num_streams(1)};
+        ov::Tensor input(ov::element::f32, {2, channels});
+        std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+
+        auto compiledModel1 = core.compile_model(makeModel(1), ov::test::utils::DEVICE_CPU, config);
+        auto inferReq1 = compiledModel1.create_infer_request();
+        inferReq1.set_input_tensor(ov::Tensor(ov::element::f32, {1, channels}, input.data<float>()));
+        inferReq1.infer();
+
+        auto rss_init = ov::test::utils::getVmRSSInKB();
+        auto compiledModel2 = core.compile_model(makeModel(2), ov::test::utils::DEVICE_CPU, config);
+        auto inferReq2 = compiledModel2.create_infer_request();
+        inferReq2.set_input_tensor(input);
+        inferReq2.infer();
+        auto rss_compiled = ov::test::utils::getVmRSSInKB();
+
+        // each row of the second batch is the output of the first model, up to the accumulation order
+        auto output1 = inferReq1.get_output_tensor().data<float>();
+        auto output2 = inferReq2.get_output_tensor().data<float>();
+        for (size_t b = 0; b < 2; b++) {
+            for (size_t i = 0; i < channels; i++) {
+                if (std::abs(output1[i] - output2[b * channels + i]) > 1e-4f * std::abs(output1[i])) {
+                    std::cerr << "Test failed: the outputs differ at " << b << ", " << i << std::endl;
+                    exit(1);
+                }
+            }
+        }
+
+        // the packed weights of the first compiled model are reused, so the memory grows by much less
+        // than the size of the weights
+        if (rss_compiled > rss_init + weightsSizeKB / 2) {
+            std::cerr << "Test failed: the memory grows by " << rss_compiled - rss_init << " KB, while the weights are "
+                      << weightsSizeKB << " KB" << std::endl;
+            exit(1);
+        }
+        std::cerr << "Test passed" << std::endl;
+        exit(0);
+    };
+
+    // Run test in a separate process to not affect RAM values by previous tests
+    EXPECT_EXIT(test(), ::testing::ExitedWithCode(0), "Test passed");
+}
+
+#endif  // __APPLE__
+
+}  // namespace SubgraphTestsDefinitions
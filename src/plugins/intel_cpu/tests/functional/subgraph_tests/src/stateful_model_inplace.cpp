@@ -0,0 +1,201 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+/*This test runs the following subgraph:
+
+       ReadValue   Param
+        |     \     /
+        |      Add
+     Multiply    |
+        |      Assign
+      Output
+
+  The ReadValue consumers read the state memory in place and the Add writes the new state value in place.
+  The main purpose of this test is checking that the double buffered states are not mixed up between the
+  inferences and between the infer requests sharing the same graph.
+*/
+
+namespace SubgraphTestsDefinitions {
+
+class StatefulModelInPlace : public ::testing::Test, public CPUTestsBase {
+public:
+    std::shared_ptr<ov::Model> makeModel() {
+        const ov::Shape shape{1, 16};
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "state"});
+        auto init = ov::opset8::Constant::create(ov::element::f32, shape, {0.0f});
+        auto read = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::opset8::Add>(read, param);
+        auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+        auto multiply =
+            std::make_shared<ov::opset8::Multiply>(read, ov::opset8::Constant::create(ov::element::f32, {1}, {2.0f}));
+        auto result = std::make_shared<ov::opset8::Result>(multiply);
+        return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                           ov::SinkVector{assign},
+                                           ov::ParameterVector{param},
+                                           "StatefulModelInPlace");
+    }
+
+    static void checkValues(const ov::Tensor& tensor, float expected) {
+        auto data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            ASSERT_FLOAT_EQ(expected, data[i]) << "at index " << i;
+        }
+    }
+};
+
+TEST_F(StatefulModelInPlace, smoke_StatesOfTwoRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU, ov::hint::num_requests(1));
+    auto inferReq1 = compiledModel.create_infer_request();
+    auto inferReq2 = compiledModel.create_infer_request();
+
+    ov::Tensor input(ov::element::f32, {1, 16});
+    std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+    inferReq1.set_input_tensor(input);
+    inferReq2.set_input_tensor(input);
+
+    constexpr size_t num_iter = 5;
+    for (size_t i = 0; i < num_iter; i++) {
+        inferReq1.infer();
+        // the output is computed from the state value before the inference
+        checkValues(inferReq1.get_output_tensor(), 2.0f * i);
+        checkValues(inferReq1.query_state().front().get_state(), i + 1.0f);
+    }
+
+    // the second request shares the graph, but has its own state
+    inferReq2.infer();
+    checkValues(inferReq2.get_output_tensor(), 0.0f);
+    checkValues(inferReq2.query_state().front().get_state(), 1.0f);
+
+    inferReq1.infer();
+    checkValues(inferReq1.get_output_tensor(), 2.0f * num_iter);
+
+    // the state set by the user is picked up by the next inference
+    auto state = inferReq2.query_state().front();
+    ov::Tensor newState(ov::element::f32, {1, 16});
+    std::fill_n(newState.data<float>(), newState.get_size(), 10.0f);
+    state.set_state(newState);
+    inferReq2.infer();
+    checkValues(inferReq2.get_output_tensor(), 20.0f);
+    checkValues(state.get_state(), 11.0f);
+
+    state.reset();
+    inferReq2.infer();
+    checkValues(inferReq2.get_output_tensor(), 0.0f);
+}
+
+/*This test runs the growing state subgraph, which is typical for the KV cache of the decoder models:
+
+       ReadValue   Param
+             \     /
+             Concat
+             /    \
+         Assign  Output
+
+  The state has dynamic shape [1, heads, length, channels] and only the new data is appended to it along
+  the length axis, so the test checks that the state keeps the whole history of the inputs while its memory
+  grows. With several heads the data of each head is followed by the data of the next one, so the new data
+  is appended to each head separately.
+*/
+
+class StatefulModelGrowingState : public ::testing::TestWithParam<size_t>, public CPUTestsBase {
+public:
+    static constexpr size_t channels = 4;
+    static constexpr size_t axis = 2;
+
+    static std::string getTestCaseName(const testing::TestParamInfo<size_t>& obj) {
+        return "heads=" + std::to_string(obj.param);
+    }
+
+    std::shared_ptr<ov::Model> makeModel() {
+        const ov::PartialShape shape{1, static_cast<int64_t>(heads), -1, channels};
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "state"});
+        auto init = ov::opset8::Constant::create(ov::element::f32, {1, heads, 0, channels}, std::vector<float>{});
+        auto read = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{read, param}, axis);
+        auto assign = std::make_shared<ov::opset8::Assign>(concat, variable);
+        auto result = std::make_shared<ov::opset8::Result>(concat);
+        return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                           ov::SinkVector{assign},
+                                           ov::ParameterVector{param},
+                                           "StatefulModelGrowingState");
+    }
+
+    // the value of each element is the index of the token along the concatenation axis plus the offset,
+    // and the index of the head multiplied by 1000
+    void checkTokens(const ov::Tensor& tensor, size_t length, float offset) const {
+        ASSERT_EQ(tensor.get_shape(), (ov::Shape{1, heads, length, channels}));
+        auto data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++) {
+            const auto head = i / (length * channels);
+            const auto token = i % (length * channels) / channels;
+            ASSERT_FLOAT_EQ(1000.0f * head + offset + token, data[i]) << "at index " << i;
+        }
+    }
+
+    ov::Tensor makeTokens(size_t first, size_t length) const {
+        ov::Tensor tokens(ov::element::f32, {1, heads, length, channels});
+        auto data = tokens.data<float>();
+        for (size_t i = 0; i < tokens.get_size(); i++) {
+            const auto head = i / (length * channels);
+            const auto token = i % (length * channels) / channels;
+            data[i] = static_cast<float>(1000 * head + first + token);
+        }
+        return tokens;
+    }
+
+protected:
+    void SetUp() override {
+        heads = GetParam();
+    }
+
+    size_t heads = 1;
+};
+
+TEST_P(StatefulModelGrowingState, smoke_AppendTokens) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU);
+    auto inferReq = compiledModel.create_infer_request();
+
+    // the prompt followed by the single tokens
+    constexpr size_t prompt_length = 3;
+    inferReq.set_input_tensor(makeTokens(0, prompt_length));
+    inferReq.infer();
+    checkTokens(inferReq.get_output_tensor(), prompt_length, 0.0f);
+
+    constexpr size_t num_tokens = 20;
+    for (size_t i = prompt_length; i < num_tokens; i++) {
+        inferReq.set_input_tensor(makeTokens(i, 1));
+        inferReq.infer();
+        checkTokens(inferReq.get_output_tensor(), i + 1, 0.0f);
+        checkTokens(inferReq.query_state().front().get_state(), i + 1, 0.0f);
+    }
+
+    // the reset state takes the empty initializer value
+    inferReq.query_state().front().reset();
+    inferReq.set_input_tensor(makeTokens(10, 2));
+    inferReq.infer();
+    checkTokens(inferReq.get_output_tensor(), 2, 10.0f);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_StatefulModelGrowingState,
+                         StatefulModelGrowingState,
+                         ::testing::Values(1, 4),
+                         StatefulModelGrowingState::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
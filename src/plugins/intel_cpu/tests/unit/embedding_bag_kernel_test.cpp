@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include "nodes/kernels/x64/embedding_bag.hpp"
+#include "utils/bfloat16.hpp"
+
+using namespace ov::intel_cpu;
+using namespace ov::intel_cpu::kernel;
+
+namespace {
+
+using EmbeddingBagKernel = JitKernel<EmbeddingBagCompileParams, EmbeddingBagCallArgs>;
+
+struct EmbeddingBagKernelParams {
+    ov::element::Type prc;
+    bool with_weights;
+    size_t depth;
+    size_t bag_size;
+};
+
+class EmbeddingBagKernelTest : public ::testing::TestWithParam<EmbeddingBagKernelParams> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<EmbeddingBagKernelParams>& obj) {
+        std::ostringstream result;
+        result << "prc=" << obj.param.prc << "_weights=" << obj.param.with_weights << "_depth=" << obj.param.depth
+               << "_bag=" << obj.param.bag_size;
+        return result.str();
+    }
+
+protected:
+    template <typename T>
+    void run(const EmbeddingBagKernelParams& p) {
+        constexpr size_t rows = 100lu;
+        std::mt19937 gen(42);
+        // the small integer values are summed by f32 exactly, so the order of the reduction does not matter
+        std::uniform_int_distribution<int> values(-8, 8);
+        std::uniform_int_distribution<int> row_indices(0, rows - 1);
+
+        std::vector<T> table(rows * p.depth);
+        for (auto& value : table)
+            value = static_cast<T>(static_cast<float>(values(gen)));
+        std::vector<int> indices(p.bag_size);
+        for (auto& index : indices)
+            index = row_indices(gen);
+        std::vector<float> weights(p.bag_size);
+        for (auto& weight : weights)
+            weight = static_cast<float>(values(gen)) / 2.f;
+
+        EmbeddingBagCompileParams jcp;
+        jcp.src_data_type = p.prc;
+        jcp.with_weights = p.with_weights;
+        auto kernel = EmbeddingBagKernel::createInstance<EmbeddingBag>(jcp);
+        ASSERT_NE(nullptr, kernel);
+
+        const size_t vec_len = kernel->getVectorLen() / sizeof(float);
+        const size_t work_amount = p.depth - p.depth % vec_len;
+        if (work_amount == 0lu)
+            GTEST_SKIP() << "The row is shorter than the vector";
+
+        std::vector<float> dst(p.depth, -1.f);
+        EmbeddingBagCallArgs args;
+        args.src_ptr = table.data();
+        args.indices_ptr = indices.data();
+        args.weights_ptr = p.with_weights ? weights.data() : nullptr;
+        args.dst_ptr = dst.data();
+        args.indices_num = indices.size();
+        args.row_size = p.depth * sizeof(T);
+        args.work_amount = work_amount;
+        (*kernel)(&args);
+
+        for (size_t i = 0lu; i < work_amount; i++) {
+            float expected = 0.f;
+            for (size_t j = 0lu; j < indices.size(); j++) {
+                const float value = static_cast<float>(table[indices[j] * p.depth + i]);
+                expected += p.with_weights ? value * weights[j] : value;
+            }
+            ASSERT_EQ(expected, dst[i]) << "at " << i;
+        }
+        // the tail of the row is not touched by the kernel
+        for (size_t i = work_amount; i < p.depth; i++) {
+            ASSERT_EQ(-1.f, dst[i]) << "at " << i;
+        }
+    }
+};
+
+TEST_P(EmbeddingBagKernelTest, CompareWithRefs) {
+    const auto& p = GetParam();
+    if (p.prc == ov::element::bf16) {
+        run<bfloat16_t>(p);
+    } else {
+        run<float>(p);
+    }
+}
+
+const std::vector<EmbeddingBagKernelParams> params = {
+    {ov::element::f32, false, 16, 1},
+    {ov::element::f32, false, 64, 3},
+    {ov::element::f32, true, 64, 20},
+    {ov::element::f32, true, 100, 9},
+    {ov::element::f32, false, 257, 17},
+    {ov::element::bf16, false, 16, 1},
+    {ov::element::bf16, true, 64, 20},
+    {ov::element::bf16, false, 100, 9},
+    {ov::element::bf16, true, 257, 17},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBag,
+                         EmbeddingBagKernelTest,
+                         ::testing::ValuesIn(params),
+                         EmbeddingBagKernelTest::getTestCaseName);
+
+// Microbenchmark of the table reduction, the bags of the same total size are drawn
+// with the uniform and the skewed pooling factors.
+TEST(EmbeddingBagKernelBenchmark, DISABLED_reduce_bags) {
+    constexpr size_t rows = 1000000lu;
+    constexpr size_t depth = 128lu;
+    constexpr size_t total_indices = 1lu << 20;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> row_indices(0, rows - 1);
+
+    std::vector<float> table(rows * depth, 1.f);
+    std::vector<int> indices(total_indices);
+    for (auto& index : indices)
+        index = row_indices(gen);
+    std::vector<float> dst(depth);
+
+    auto kernel = EmbeddingBagKernel::createInstance<EmbeddingBag>(EmbeddingBagCompileParams{});
+    ASSERT_NE(nullptr, kernel);
+
+    auto measure = [&](const std::string& name, const std::vector<size_t>& bag_sizes) {
+        const auto start = std::chrono::steady_clock::now();
+        size_t offset = 0lu;
+        for (const auto bag_size : bag_sizes) {
+            EmbeddingBagCallArgs args;
+            args.src_ptr = table.data();
+            args.indices_ptr = indices.data() + offset;
+            args.weights_ptr = nullptr;
+            args.dst_ptr = dst.data();
+            args.indices_num = bag_size;
+            args.row_size = depth * sizeof(float);
+            args.work_amount = depth;
+            (*kernel)(&args);
+            offset += bag_size;
+        }
+        const auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << name << ": " << bag_sizes.size() << " bags, " << time << " ms, "
+                  << offset * depth * sizeof(float) / time / 1e6 << " GB/s" << std::endl;
+    };
+
+    std::vector<size_t> uniform(total_indices / 64, 64);
+    measure("uniform pooling factor 64", uniform);
+
+    std::vector<size_t> skewed;
+    std::geometric_distribution<size_t> pooling(1.0 / 64);
+    for (size_t used = 0lu; used < total_indices;) {
+        const auto bag_size = std::min(pooling(gen) + 1lu, total_indices - used);
+        skewed.push_back(bag_size);
+        used += bag_size;
+    }
+    measure("geometric pooling factor 64", skewed);
+}
+
+}  // namespace
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/relu.hpp>
+#include <openvino/op/result.hpp>
+
+#include "graph.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<const ov::Model> createDynamicModel() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    param->set_friendly_name("input");
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+}  // namespace
+
+TEST(RuntimeCacheWarmUpTest, WarmUpFillsRuntimeCache) {
+    Config conf;
+    conf.rtCacheCapacity = 100;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, nullptr, false);
+    Graph graph;
+    graph.CreateGraph(createDynamicModel(), context);
+    ASSERT_EQ(context->getParamsCache()->getSize(), 0);
+
+    graph.WarmUp({{{"input", {2, 16}}}});
+    const auto warmedUp = context->getParamsCache()->getSize();
+    ASSERT_GT(warmedUp, 0);
+
+    // the same shapes hit the records created by the first warm up
+    graph.WarmUp({{{"input", {2, 16}}}});
+    ASSERT_EQ(context->getParamsCache()->getSize(), warmedUp);
+
+    // the shapes incompatible with the model inputs are skipped
+    graph.WarmUp({{{"input", {2, 8}}}, {{"other", {2, 16}}}});
+    ASSERT_EQ(context->getParamsCache()->getSize(), warmedUp);
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -219,6 +221,7 @@ TEST(MultiCacheTests, GetOrCreate) {
     auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(strBuilderMock.build(key)); };
 
     MultiCache cache(capacity);
+    ASSERT_EQ(cache.getSize(), 0);
 
     //creating so we miss everytime
     for (int i = 0; i < capacity; ++i) {
@@ -231,6 +234,7 @@ TEST(MultiCacheTests, GetOrCreate) {
         ASSERT_EQ(*strResult.first, std::to_string(i));
         ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
     }
+    ASSERT_EQ(cache.getSize(), 2 * capacity);
 
     //always hit
     for (int i = 0; i < capacity; ++i) {
@@ -255,6 +259,7 @@ TEST(MultiCacheTests, GetOrCreate) {
         ASSERT_EQ(*strResult.first, std::to_string(i));
         ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
     }
+    ASSERT_EQ(cache.getSize(), 2 * capacity);
 
     //can not hit the old ones
     for (int i = 0; i < capacity; ++i) {
@@ -379,3 +384,133 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ShardedLruCacheTests, PutGet) {
+    constexpr int records = 100;
+    ShardedLruCache<IntKey, int> cache(1024);
+    for (int i = 0; i < records; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 0; i < records; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.get({records}), int());
+    ASSERT_EQ(cache.getSize(), records);
+}
+
+TEST(ShardedLruCacheTests, RecordsCapacity) {
+    constexpr size_t recordsPerShard = 4;
+    constexpr size_t shards = 4;
+    ShardedLruCache<IntKey, int> cache(recordsPerShard * shards, shards);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+        ASSERT_LE(cache.getSize(), cache.getCapacity());
+    }
+    ASSERT_EQ(cache.getSize(), cache.getCapacity());
+
+    // the most recently added record is always kept
+    ASSERT_EQ(cache.get({999}), 999);
+    ASSERT_NO_THROW(cache.evict(recordsPerShard));
+    ASSERT_EQ(cache.getSize(), 0);
+    ASSERT_EQ(cache.get({999}), int());
+}
+
+TEST(ShardedLruCacheTests, CapacityNotDivisibleByShards) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.getSize(), capacity);
+
+    // there are less records than shards, but every record is stored
+    ShardedLruCache<IntKey, int> smallCache(2);
+    ASSERT_NO_THROW(smallCache.put({1}, 1));
+    ASSERT_NO_THROW(smallCache.put({2}, 2));
+    ASSERT_EQ(smallCache.get({1}), 1);
+    ASSERT_EQ(smallCache.get({2}), 2);
+}
+
+TEST(ShardedLruCacheTests, LruPolicy) {
+    constexpr int capacity = 10;
+    // single shard to make the eviction order deterministic
+    ShardedLruCache<IntKey, int> cache(capacity, 1);
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    ShardedLruCache<IntKey, int> cache(0);
+    ASSERT_NO_THROW(cache.put({1}, 1));
+    ASSERT_EQ(cache.get({1}), int());
+    ASSERT_EQ(cache.getSize(), 0);
+}
+
+TEST(MultiCacheTests, SharedBetweenThreads) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int records = 100;
+    constexpr size_t numThreads = 30;
+
+    std::atomic<int> intBuilds{0};
+    std::atomic<int> strBuilds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        intBuilds++;
+        return std::make_shared<int>(key.data);
+    };
+    auto strBuilder = [&](const StringKey& key) {
+        strBuilds++;
+        return std::make_shared<std::string>(key.data);
+    };
+
+    MultiCache cache(1024, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < records; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+            auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+            ASSERT_NE(strResult.first, StrValueType());
+            ASSERT_EQ(*strResult.first, std::to_string(i));
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // concurrent misses may build the same value more than once, but most of the lookups must hit
+    ASSERT_LT(intBuilds.load(), static_cast<int>(numThreads * records));
+    ASSERT_LT(strBuilds.load(), static_cast<int>(numThreads * records));
+
+    for (int i = 0; i < records; ++i) {
+        auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+        auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+        ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "cache/runtime_shapes_store.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+class RuntimeShapesStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        filePath = std::string("RuntimeShapesStoreTest_") + testName + ".cpu_rt_shapes";
+        std::remove(filePath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(filePath.c_str());
+    }
+
+    std::string filePath;
+};
+}  // namespace
+
+TEST_F(RuntimeShapesStoreTest, AddUnique) {
+    RuntimeShapesStore store(filePath, 10, 0);
+    ASSERT_TRUE(store.add({{"input", {1, 3, 224, 224}}}));
+    ASSERT_FALSE(store.add({{"input", {1, 3, 224, 224}}}));
+    ASSERT_TRUE(store.add({{"input", {2, 3, 224, 224}}}));
+    ASSERT_EQ(store.getRecords().size(), 2);
+}
+
+TEST_F(RuntimeShapesStoreTest, MaxRecords) {
+    RuntimeShapesStore store(filePath, 3, 0);
+    for (size_t i = 1; i < 10; ++i) {
+        store.add({{"input", {i, 128}}});
+    }
+    ASSERT_EQ(store.getRecords().size(), 3);
+}
+
+TEST_F(RuntimeShapesStoreTest, SaveAndLoad) {
+    const RuntimeShapesStore::InputShapes first = {{"input_ids", {1, 17}}, {"attention_mask", {1, 17}}};
+    const RuntimeShapesStore::InputShapes second = {{"input_ids", {4, 128}}, {"attention_mask", {4, 128}}};
+    {
+        RuntimeShapesStore store(filePath, 10, 0);
+        store.add(first);
+        store.add(second);
+    }
+
+    RuntimeShapesStore store(filePath, 10, 0);
+    const auto records = store.getRecords();
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records[0], first);
+    ASSERT_EQ(records[1], second);
+}
+
+TEST_F(RuntimeShapesStoreTest, PeriodicFlush) {
+    RuntimeShapesStore store(filePath, 10, 2);
+    store.add({{"input", {1}}});
+    ASSERT_EQ(RuntimeShapesStore(filePath, 10, 0).getRecords().size(), 0);
+    store.add({{"input", {2}}});
+    ASSERT_EQ(RuntimeShapesStore(filePath, 10, 0).getRecords().size(), 2);
+}
+
+TEST_F(RuntimeShapesStoreTest, CorruptedFileIsIgnored) {
+    {
+        std::ofstream os(filePath, std::ios::binary);
+        os << "definitely not a shapes store";
+    }
+    RuntimeShapesStore store(filePath, 10, 0);
+    ASSERT_TRUE(store.getRecords().empty());
+    ASSERT_TRUE(store.add({{"input", {1, 3}}}));
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include <openvino/op/add.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/result.hpp>
+#include <openvino/runtime/shared_buffer.hpp>
+
+#include "serialize.h"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+const std::vector<float> weights = {1.f, 2.f, 3.f, 4.f};
+
+std::shared_ptr<ov::Model> createModel() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4});
+    auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 4}, weights);
+    auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+std::string exportModel(const std::shared_ptr<ov::Model>& model) {
+    std::stringstream stream;
+    CNNNetworkSerializer serializer(stream, std::make_shared<ExtensionManager>());
+    serializer << CNNNetwork(model);
+    return stream.str();
+}
+
+// imports the model and returns the constants passed to the network builder
+Blob::CPtr importWeights(std::istream& stream, const std::shared_ptr<ov::Model>& model) {
+    Blob::CPtr constants;
+    CNNNetworkDeserializer deserializer(stream, [&](const std::string&, const Blob::CPtr& blob) {
+        constants = blob;
+        return CNNNetwork(model->clone());
+    });
+    CNNNetwork network;
+    deserializer >> network;
+    return constants;
+}
+
+bool containsWeights(const Blob::CPtr& constants) {
+    const auto data = constants->cbuffer().as<const char*>();
+    const auto weightsData = reinterpret_cast<const char*>(weights.data());
+    const auto weightsSize = weights.size() * sizeof(float);
+    for (size_t i = 0; i + weightsSize <= constants->byteSize(); i++) {
+        if (std::memcmp(data + i, weightsData, weightsSize) == 0)
+            return true;
+    }
+    return false;
+}
+}  // namespace
+
+TEST(SerializeTest, ImportFromSharedBufferReferencesConstants) {
+    const auto model = createModel();
+    const auto exported = exportModel(model);
+
+    // the same layout as a memory mapped cache entry
+    auto buffer = std::make_shared<ov::AlignedBuffer>(exported.size());
+    std::memcpy(buffer->get_ptr<char>(), exported.data(), exported.size());
+    ov::SharedStreamBuffer streamBuffer(buffer);
+    std::istream stream(&streamBuffer);
+
+    const auto constants = importWeights(stream, model);
+    ASSERT_NE(constants, nullptr);
+    ASSERT_TRUE(containsWeights(constants));
+
+    // the constants are not copied, they point into the buffer the stream reads from
+    const auto data = constants->cbuffer().as<const char*>();
+    const auto begin = buffer->get_ptr<char>();
+    ASSERT_GE(data, begin);
+    ASSERT_LE(data + constants->byteSize(), begin + buffer->size());
+}
+
+TEST(SerializeTest, ImportFromStreamCopiesConstants) {
+    const auto model = createModel();
+    std::stringstream stream(exportModel(model));
+
+    const auto constants = importWeights(stream, model);
+    ASSERT_NE(constants, nullptr);
+    ASSERT_TRUE(containsWeights(constants));
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <dnnl_extension_utils.h>
+#include <dnnl_types.h>
+#include <weights_cache.hpp>
+#include <openvino/runtime/compute_hash.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+class WeightsSharingWithSize : public WeightsSharing {
+public:
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(guard);
+        return sharedWeights.size();
+    }
+};
+
+MemoryPtr createMemory(const dnnl::engine& eng) {
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape{4, 4});
+    return std::make_shared<Memory>(eng, desc);
+}
+}  // namespace
+
+TEST(WeightsCacheTest, ContentKeyDoesNotDependOnDataLocation) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsHashes hashes;
+    MemoryPtr weights1 = createMemory(eng);
+    MemoryPtr weights2 = createMemory(eng);
+    std::fill_n(static_cast<float*>(weights1->getData()), 16, 0.5f);
+    std::fill_n(static_cast<float*>(weights2->getData()), 16, 0.5f);
+    const auto size = weights1->getSize();
+
+    const auto key = WeightsSharing::contentKey("layout", hashes.get(weights1), size);
+    ASSERT_EQ(key, WeightsSharing::contentKey("layout", hashes.get(weights2), size));
+    ASSERT_NE(key, WeightsSharing::contentKey("other_layout", hashes.get(weights2), size));
+
+    MemoryPtr weights3 = createMemory(eng);
+    std::fill_n(static_cast<float*>(weights3->getData()), 16, 0.5f);
+    static_cast<float*>(weights3->getData())[15] = 1.0f;
+    ASSERT_NE(key, WeightsSharing::contentKey("layout", hashes.get(weights3), size));
+}
+
+TEST(WeightsCacheTest, ContentHashIsComputedOnce) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsHashes hashes;
+    MemoryPtr weights = createMemory(eng);
+    std::fill_n(static_cast<float*>(weights->getData()), 16, 0.5f);
+    const auto hash = hashes.get(weights);
+
+    // the constants don't change, so the data is not hashed again while the memory is alive
+    static_cast<float*>(weights->getData())[0] = 1.0f;
+    ASSERT_EQ(hash, hashes.get(weights));
+
+    // the hash of the released memory is not taken for the new one, even if it has the same address
+    weights.reset();
+    MemoryPtr other = createMemory(eng);
+    std::fill_n(static_cast<float*>(other->getData()), 16, 2.0f);
+    ASSERT_EQ(ov::runtime::compute_hash(other->getData(), other->getSize()), hashes.get(other));
+}
+
+TEST(WeightsCacheTest, DescribeDistinguishesLayouts) {
+    const auto layout = WeightsSharing::describe(CpuBlockedMemoryDesc(Precision::FP32, Shape{4, 8}));
+    ASSERT_EQ(layout, WeightsSharing::describe(CpuBlockedMemoryDesc(Precision::FP32, Shape{4, 8})));
+    ASSERT_NE(layout, WeightsSharing::describe(CpuBlockedMemoryDesc(Precision::FP32, Shape{8, 4})));
+    ASSERT_NE(layout, WeightsSharing::describe(CpuBlockedMemoryDesc(Precision::BF16, Shape{4, 8})));
+}
+
+TEST(WeightsCacheTest, DescribeDistinguishesExtraData) {
+    const dnnl::memory::desc plain({16, 32}, dnnl::memory::data_type::s8, dnnl::memory::format_tag::ab);
+    dnnl::memory::desc compensated({16, 32}, dnnl::memory::data_type::s8, dnnl::memory::format_tag::ab);
+    // the same format with the compensation of the int8 weights attached
+    compensated.get()->extra.flags = dnnl_memory_extra_flag_compensation_conv_s8s8;
+    compensated.get()->extra.compensation_mask = 1;
+
+    const auto layout = WeightsSharing::describe(*DnnlExtensionUtils::makeDescriptor(plain));
+    ASSERT_EQ(layout, WeightsSharing::describe(*DnnlExtensionUtils::makeDescriptor(plain)));
+    ASSERT_NE(layout, WeightsSharing::describe(*DnnlExtensionUtils::makeDescriptor(compensated)));
+}
+
+TEST(WeightsCacheTest, MemoryIsSharedWhileUsed) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharingWithSize cache;
+    size_t created = 0;
+    auto create = [&]() {
+        created++;
+        return createMemory(eng);
+    };
+
+    MemoryPtr mem1 = *cache.findOrCreate("key", create);
+    MemoryPtr mem2 = *cache.findOrCreate("key", create);
+    ASSERT_EQ(mem1, mem2);
+    ASSERT_EQ(created, 1u);
+
+    // the cache doesn't hold the memory, so it is created again after all the users released it
+    mem1.reset();
+    mem2.reset();
+    MemoryPtr mem3 = *cache.findOrCreate("key", create);
+    ASSERT_EQ(created, 2u);
+    ASSERT_EQ(cache.size(), 1u);
+}
+
+TEST(WeightsCacheTest, ExpiredEntriesArePurged) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharingWithSize cache;
+    auto create = [&]() {
+        return createMemory(eng);
+    };
+
+    MemoryPtr alive = *cache.findOrCreate("alive", create);
+    for (size_t i = 0; i < 1000; i++) {
+        MemoryPtr released = *cache.findOrCreate("released_" + std::to_string(i), create);
+    }
+    ASSERT_LT(cache.size(), 200u);
+    ASSERT_EQ(alive, static_cast<MemoryPtr>(*cache.get("alive")));
+}
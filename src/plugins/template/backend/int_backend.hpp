@@ -31,7 +31,7 @@ public:
 
     ov::Tensor create_tensor(const element::Type& type, const Shape& shape) override;
 
-    std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model) override;
+    std::shared_ptr<Executable> compile(std::shared_ptr<ov::Model> model, bool parallel_execution = false) override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
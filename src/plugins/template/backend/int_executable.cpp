@@ -9,6 +9,7 @@
 
 #include "evaluates_map.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape_util.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
@@ -41,12 +42,41 @@ public:
     }
 };
 
-ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov::Model>& model) : m_is_compiled{true} {
+ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov::Model>& model,
+                                                      bool parallel_execution)
+    : m_is_compiled{true} {
     m_model = model->clone();
     for (auto node : m_model->get_ordered_ops()) {
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_model);
+
+    if (parallel_execution) {
+        std::unordered_map<const Node*, size_t> node_groups;
+        size_t last_variable_group = 0;
+        bool has_variables = false;
+        for (const auto& node : m_nodes) {
+            size_t group = 0;
+            for (const auto& input : node->input_values())
+                group = std::max(group, node_groups.at(input.get_node()) + 1);
+            for (const auto& dependency : node->get_control_dependencies())
+                group = std::max(group, node_groups.at(dependency.get()) + 1);
+            // the nodes accessing the variables keep their order, as they share the variable context
+            if (std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node)) {
+                if (has_variables)
+                    group = std::max(group, last_variable_group + 1);
+                last_variable_group = group;
+                has_variables = true;
+            }
+            node_groups.emplace(node.get(), group);
+
+            if (ov::is_type<ov::op::v0::Parameter>(node))
+                continue;
+            if (m_parallel_groups.size() <= group)
+                m_parallel_groups.resize(group + 1);
+            m_parallel_groups[group].push_back(node);
+        }
+    }
 }
 
 void ov::runtime::interpreter::INTExecutable::cancel() {
@@ -106,47 +136,8 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
 
     auto overrider = TemporaryOverrideOutputs(m_model, tensor_map);
 
-    // for each ordered op in the graph
-    for (const auto& op : m_nodes) {
-        CHECK_TERMINATE()
-        if (std::dynamic_pointer_cast<ov::op::v0::Parameter>(op)) {
-            continue;
-        }
-        // get op inputs from map
-        std::vector<ov::Tensor> op_inputs;
-        for (auto input : op->inputs()) {
-            auto tensor = input.get_tensor_ptr();
-            op_inputs.push_back(tensor_map.at(tensor));
-        }
-
-        // get op outputs from map or create
-        std::vector<ov::Tensor> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            ov::Tensor host_tensor;
-            auto it = tensor_map.find(tensor);
-            auto output = op->output(i);
-            if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
-                OPENVINO_SUPPRESS_DEPRECATED_START
-                host_tensor = ov::Tensor(
-                    output.get_element_type(),
-                    output.get_partial_shape().is_dynamic() ? ov::util::make_dynamic_shape() : output.get_shape());
-                OPENVINO_SUPPRESS_DEPRECATED_END
-            } else {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
-        }
-
-        {
-            PERF(op, collect_performance);
-            // Call evaluate for cloned_node with static shapes
-            if (!op->evaluate(op_outputs, op_inputs, context)) {
-                // TODO: extend evaluate map for the context
-                evaluate_node(op, op_outputs, op_inputs);
-            }
-        }
-        // Update tensors in tensor map
+    // Update tensors in tensor map
+    const auto update_tensors = [&](const std::shared_ptr<Node>& op, const ov::TensorVector& op_outputs) {
         for (size_t i = 0; i < op->get_output_size(); ++i) {
             auto tensor = op->output(i).get_tensor_ptr();
             tensor_map.insert({tensor, op_outputs[i]});
@@ -159,11 +150,84 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
                 }
             }
         }
+    };
+
+    if (m_parallel_groups.empty()) {
+        // for each ordered op in the graph
+        for (const auto& op : m_nodes) {
+            CHECK_TERMINATE()
+            if (std::dynamic_pointer_cast<ov::op::v0::Parameter>(op)) {
+                continue;
+            }
+            update_tensors(op, run_node(op, tensor_map, context, collect_performance));
+        }
+        return true;
+    }
+
+    for (const auto& group : m_parallel_groups) {
+        CHECK_TERMINATE()
+        std::vector<ov::TensorVector> group_outputs(group.size());
+        std::vector<std::exception_ptr> errors(group.size());
+        // the tensor map is only read while the group is executed
+        ov::parallel_for(group.size(), [&](size_t i) {
+            try {
+                group_outputs[i] = run_node(group[i], tensor_map, context, collect_performance);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (size_t i = 0; i < group.size(); ++i) {
+            if (errors[i])
+                std::rethrow_exception(errors[i]);
+            update_tensors(group[i], group_outputs[i]);
+        }
     }
 
     return true;
 }
 
+ov::TensorVector ov::runtime::interpreter::INTExecutable::run_node(
+    const std::shared_ptr<Node>& op,
+    const std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor>& tensor_map,
+    const ov::EvaluationContext& context,
+    bool collect_performance) const {
+    // get op inputs from map
+    std::vector<ov::Tensor> op_inputs;
+    for (auto input : op->inputs()) {
+        auto tensor = input.get_tensor_ptr();
+        op_inputs.push_back(tensor_map.at(tensor));
+    }
+
+    // get op outputs from map or create
+    std::vector<ov::Tensor> op_outputs;
+    for (size_t i = 0; i < op->get_output_size(); ++i) {
+        auto tensor = op->output(i).get_tensor_ptr();
+        ov::Tensor host_tensor;
+        auto it = tensor_map.find(tensor);
+        auto output = op->output(i);
+        if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
+            OPENVINO_SUPPRESS_DEPRECATED_START
+            host_tensor = ov::Tensor(
+                output.get_element_type(),
+                output.get_partial_shape().is_dynamic() ? ov::util::make_dynamic_shape() : output.get_shape());
+            OPENVINO_SUPPRESS_DEPRECATED_END
+        } else {
+            host_tensor = it->second;
+        }
+        op_outputs.push_back(host_tensor);
+    }
+
+    {
+        PERF(op, collect_performance);
+        // Call evaluate for cloned_node with static shapes
+        if (!op->evaluate(op_outputs, op_inputs, context)) {
+            // TODO: extend evaluate map for the context
+            evaluate_node(op, op_outputs, op_inputs);
+        }
+    }
+    return op_outputs;
+}
+
 std::shared_ptr<ov::op::v0::Parameter> ov::runtime::interpreter::INTExecutable::get_parameter(size_t index) const {
     const ParameterVector& parameters = get_parameters();
     OPENVINO_ASSERT(index < parameters.size(), "create_tensor for input out of bounds");
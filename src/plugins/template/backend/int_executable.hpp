@@ -9,6 +9,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "backend.hpp"
@@ -26,7 +27,8 @@ class INTExecutable : public Executable {
     friend class INTBackend;
 
 public:
-    INTExecutable(const std::shared_ptr<ov::Model>& model);
+    /// \param parallel_execution Allows to execute the independent nodes concurrently
+    INTExecutable(const std::shared_ptr<ov::Model>& model, bool parallel_execution = false);
 
     void cancel() override;
 
@@ -54,9 +56,17 @@ protected:
     bool evaluate_node(const std::shared_ptr<Node>& node,
                        ov::TensorVector& outputs,
                        const ov::TensorVector& inputs) const;
+    ov::TensorVector run_node(
+        const std::shared_ptr<Node>& node,
+        const std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor>& tensor_map,
+        const ov::EvaluationContext& context,
+        bool collect_performance) const;
     bool m_is_compiled = false;
     std::shared_ptr<ov::Model> m_model;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    // the nodes grouped by the length of the longest path from the parameters, the nodes of a group
+    // don't depend on each other, so they are executed concurrently; empty for the serial execution
+    std::vector<std::vector<std::shared_ptr<Node>>> m_parallel_groups;
     std::atomic_bool m_cancel_execution{false};
     std::mutex m_mutex;
 
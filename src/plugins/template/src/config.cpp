@@ -23,6 +23,8 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
 
         if (ov::template_plugin::disable_transformations == key) {
             disable_transformations = value.as<bool>();
+        } else if (ov::template_plugin::parallel_execution == key) {
+            parallel_execution = value.as<bool>();
         } else if (ov::internal::exclusive_async_requests == key) {
             exclusive_async_requests = value.as<bool>();
         } else if (streamExecutorConfigKeys.end() !=
@@ -78,6 +80,8 @@ ov::Any Configuration::Get(const std::string& name) const {
         return {exclusive_async_requests};
     } else if (name == ov::template_plugin::disable_transformations) {
         return {disable_transformations};
+    } else if (name == ov::template_plugin::parallel_execution) {
+        return {parallel_execution};
     } else if (name == ov::num_streams) {
         return {std::to_string(streams_executor_config._streams)};
     } else if (name == ov::internal::cpu_bind_thread) {
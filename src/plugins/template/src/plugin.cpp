@@ -238,6 +238,7 @@ ov::Any ov::template_plugin::Plugin::get_property(const std::string& name, const
                                                     ov::hint::execution_mode,
                                                     ov::num_streams,
                                                     ov::template_plugin::disable_transformations,
+                                                    ov::template_plugin::parallel_execution,
                                                     ov::log::level};
         return rw_properties;
     };
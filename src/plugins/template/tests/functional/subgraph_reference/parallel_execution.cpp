@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/op/avg_pool.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "template/properties.hpp"
+
+namespace {
+
+std::vector<float> random_values(size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> values(size);
+    for (auto& value : values)
+        value = dist(gen);
+    return values;
+}
+
+// two independent branches with the parallelized reference kernels
+std::shared_ptr<ov::Model> make_model(std::mt19937& gen) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 8, 16, 16});
+    const ov::Shape filters_shape{16, 8, 3, 3};
+    auto filters = ov::op::v0::Constant::create(ov::element::f32,
+                                                filters_shape,
+                                                random_values(ov::shape_size(filters_shape), gen));
+    auto conv = std::make_shared<ov::op::v1::Convolution>(data,
+                                                          filters,
+                                                          ov::Strides{1, 1},
+                                                          ov::CoordinateDiff{1, 1},
+                                                          ov::CoordinateDiff{1, 1},
+                                                          ov::Strides{1, 1});
+    auto pool = std::make_shared<ov::op::v1::AvgPool>(conv,
+                                                      ov::Strides{2, 2},
+                                                      ov::Shape{1, 1},
+                                                      ov::Shape{1, 1},
+                                                      ov::Shape{3, 3},
+                                                      false);
+
+    auto matrices = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{4, 32, 64});
+    const ov::Shape weights_shape{48, 64};
+    auto weights = ov::op::v0::Constant::create(ov::element::f32,
+                                                weights_shape,
+                                                random_values(ov::shape_size(weights_shape), gen));
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(matrices, weights, false, true);
+
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(pool),
+                                                        std::make_shared<ov::op::v0::Result>(matmul)},
+                                       ov::ParameterVector{data, matrices});
+}
+
+}  // namespace
+
+TEST(TemplateParallelExecutionTests, BitExactWithSerialExecution) {
+    std::mt19937 gen(42);
+    auto model = make_model(gen);
+    auto core = ov::test::utils::PluginCache::get().core("TEMPLATE");
+
+    std::vector<ov::Tensor> inputs;
+    for (const auto& param : model->get_parameters()) {
+        ov::Tensor input(param->get_element_type(), param->get_shape());
+        const auto values = random_values(input.get_size(), gen);
+        std::copy(values.begin(), values.end(), input.data<float>());
+        inputs.push_back(input);
+    }
+
+    auto infer = [&](bool parallel_execution) {
+        auto compiled_model =
+            core->compile_model(model, "TEMPLATE", ov::template_plugin::parallel_execution(parallel_execution));
+        EXPECT_EQ(compiled_model.get_property(ov::template_plugin::parallel_execution), parallel_execution);
+        auto request = compiled_model.create_infer_request();
+        for (size_t i = 0; i < inputs.size(); ++i)
+            request.set_input_tensor(i, inputs[i]);
+        request.infer();
+        std::vector<ov::Tensor> outputs;
+        for (size_t i = 0; i < model->get_output_size(); ++i) {
+            const auto result = request.get_output_tensor(i);
+            ov::Tensor output(result.get_element_type(), result.get_shape());
+            result.copy_to(output);
+            outputs.push_back(output);
+        }
+        return outputs;
+    };
+
+    const auto serial = infer(false);
+    const auto parallel = infer(true);
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        ASSERT_EQ(serial[i].get_shape(), parallel[i].get_shape());
+        EXPECT_EQ(0, std::memcmp(serial[i].data(), parallel[i].data(), serial[i].get_byte_size()))
+            << "output " << i << " differs";
+    }
+}